@@ -0,0 +1,683 @@
+/*
+PS_Canvas.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PocketStar.h"
+#include "PS_Canvas.h"
+#include "PS_Internal.h"
+
+// estimated cost of an additional window (setX, setY and the transfer setup), in pixel bytes
+const uint8_t PS_WINDOW_COST = 24;
+
+PSCanvas::PSCanvas(uint8_t *_buffer, uint8_t bitDepth, uint8_t _width, uint8_t _height) {
+    buffer = _buffer;
+    width = _width;
+    height = _height;
+    bitDepth16 = bitDepth == BitDepth16;
+    presenting = false;
+    originX = 0;
+    originY = 0;
+    cursorX = 0;
+    cursorY = 0;
+    fontHeight = 0;
+    fontFirstChar = 0;
+    fontLastChar = 0;
+    fontDescriptor = 0;
+    fontBitmap = 0;
+    fontColor = 0xFFFF;
+    fontColorBackground = 0x0000;
+    clean();
+}
+
+uint8_t *PSCanvas::getBuffer(void) {
+    return buffer;
+}
+
+uint8_t PSCanvas::getWidth(void) {
+    return width;
+}
+
+uint8_t PSCanvas::getHeight(void) {
+    return height;
+}
+
+uint8_t PSCanvas::getBitDepth(void) {
+    return bitDepth16 ? BitDepth16 : BitDepth8;
+}
+
+void PSCanvas::setOrigin(int16_t x, int16_t y) {
+    originX = x;
+    originY = y;
+}
+
+void PSCanvas::present(uint8_t x, uint8_t y) {
+    boolean depth16 = pocketstar.bitDepth16;
+    send(x, y, height);
+    clean();
+    if (pocketstar.bitDepth16 != depth16)
+        pocketstar.setBitDepth(depth16 ? BitDepth16 : BitDepth8);
+}
+
+void PSCanvas::send(uint8_t x, uint8_t y, uint8_t rows) {
+    uint8_t bytes = bitDepth16 ? 2 : 1;
+
+    pocketstar.setBitDepth(getBitDepth());
+    pocketstar.writeRows(x, y, width, rows, bytes, buffer, width * bytes);
+    presenting = true;
+}
+
+void PSCanvas::flush(uint8_t x, uint8_t y) {
+    uint8_t bytes = bitDepth16 ? 2 : 1;
+    uint8_t row = 0;
+    boolean started = false;
+    boolean depth16 = pocketstar.bitDepth16;
+
+    while (row < height) {
+        if (dirtyBegin[row] > dirtyEnd[row]) {
+            row++;
+            continue;
+        }
+
+        // grow the window downwards as long as sending the extra pixels is cheaper than a new window
+        uint8_t x1 = dirtyBegin[row];
+        uint8_t x2 = dirtyEnd[row];
+        uint8_t y1 = row;
+        uint8_t y2 = row;
+        for (uint8_t next = row + 1; next < height; next++) {
+            if (dirtyBegin[next] > dirtyEnd[next])
+                continue;
+            uint8_t u1 = PS_min(x1, dirtyBegin[next]);
+            uint8_t u2 = PS_max(x2, dirtyEnd[next]);
+            uint16_t merged = (u2 - u1 + 1) * (next - y1 + 1) * bytes;
+            uint16_t separate = (x2 - x1 + 1) * (y2 - y1 + 1) * bytes + (dirtyEnd[next] - dirtyBegin[next] + 1) * bytes + PS_WINDOW_COST;
+            if (merged > separate)
+                break;
+            x1 = u1;
+            x2 = u2;
+            y2 = next;
+        }
+
+        if (!started)
+            pocketstar.setBitDepth(getBitDepth());
+        started = true;
+        pocketstar.writeRows(x + x1, y + y1, x2 - x1 + 1, y2 - y1 + 1, bytes, buffer + (y1 * width + x1) * bytes, width * bytes);
+        for (uint8_t r = y1; r <= y2; r++) {
+            dirtyBegin[r] = 0xFF;
+            dirtyEnd[r] = 0;
+        }
+        presenting = true;
+        row = y2 + 1;
+    }
+    if (pocketstar.bitDepth16 != depth16)
+        pocketstar.setBitDepth(depth16 ? BitDepth16 : BitDepth8);
+}
+
+void PSCanvas::markDirty(int16_t x, int16_t y, int16_t w, int16_t h) {
+    for (int16_t row = y; row < y + h; row++)
+        mark(x - originX, x + w - 1 - originX, row - originY);
+}
+
+boolean PSCanvas::isDirty(void) {
+    for (uint8_t row = 0; row < height; row++) {
+        if (dirtyBegin[row] <= dirtyEnd[row])
+            return true;
+    }
+    return false;
+}
+
+void PSCanvas::mark(int16_t x1, int16_t x2, int16_t y) {
+    if (y < 0 || y >= height)
+        return;
+    if (x1 < 0)
+        x1 = 0;
+    if (x2 > width - 1)
+        x2 = width - 1;
+    if (x1 > x2)
+        return;
+    if (x1 < dirtyBegin[y])
+        dirtyBegin[y] = x1;
+    if (x2 > dirtyEnd[y])
+        dirtyEnd[y] = x2;
+}
+
+void PSCanvas::clean(void) {
+    memset(dirtyBegin, 0xFF, sizeof(dirtyBegin));
+    memset(dirtyEnd, 0, sizeof(dirtyEnd));
+}
+
+// the buffer may not change while present() is still sending it
+void PSCanvas::sync(void) {
+    if (presenting) {
+        pocketstar.waitForTransfer();
+        presenting = false;
+    }
+}
+
+uint16_t PSCanvas::native(uint8_t color) {
+    return bitDepth16 ? PS_color16(color) : color;
+}
+
+uint16_t PSCanvas::native(uint16_t color) {
+    return bitDepth16 ? color : PS_color8(color);
+}
+
+void PSCanvas::put(int16_t x, int16_t y, uint16_t color) {
+    x -= originX;
+    y -= originY;
+    if (x < 0 || y < 0 || x >= width || y >= height)
+        return;
+    if (x < dirtyBegin[y])
+        dirtyBegin[y] = x;
+    if (x > dirtyEnd[y])
+        dirtyEnd[y] = x;
+    if (bitDepth16) {
+        uint8_t *p = buffer + ((y * width + x) << 1);
+        p[0] = color >> 8;
+        p[1] = color;
+    } else
+        buffer[y * width + x] = color;
+}
+
+void PSCanvas::fillSpan(int16_t x1, int16_t x2, int16_t y, uint16_t color) {
+    x1 -= originX;
+    x2 -= originX;
+    y -= originY;
+    if (y < 0 || y >= height)
+        return;
+    if (x1 < 0)
+        x1 = 0;
+    if (x2 > width - 1)
+        x2 = width - 1;
+    if (x1 > x2)
+        return;
+    mark(x1, x2, y);
+
+    if (bitDepth16)
+        PSFormatRGB565::fill(buffer + ((y * width + x1) << 1), color, x2 - x1 + 1);
+    else
+        PSFormatRGB332::fill(buffer + y * width + x1, color, x2 - x1 + 1);
+}
+
+// drawing
+void PSCanvas::fillScreen(uint8_t color) {
+    rect(originX, originY, width, height, true, native(color));
+}
+
+void PSCanvas::fillScreen(uint16_t color) {
+    rect(originX, originY, width, height, true, native(color));
+}
+
+void PSCanvas::drawPixel(int16_t x, int16_t y, uint8_t color) {
+    sync();
+    put(x, y, native(color));
+}
+
+void PSCanvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    sync();
+    put(x, y, native(color));
+}
+
+void PSCanvas::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color) {
+    line(x1, y1, x2, y2, native(color));
+}
+
+void PSCanvas::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    line(x1, y1, x2, y2, native(color));
+}
+
+void PSCanvas::line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    sync();
+    int16_t dx = abs(x2 - x1);
+    int16_t dy = -abs(y2 - y1);
+    int8_t sx = x1 < x2 ? 1 : -1;
+    int8_t sy = y1 < y2 ? 1 : -1;
+    int16_t error = dx + dy;
+
+    while (true) {
+        put(x1, y1, color);
+        if (x1 == x2 && y1 == y2)
+            break;
+        int16_t e2 = error << 1;
+        if (e2 >= dy) {
+            error += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            error += dx;
+            y1 += sy;
+        }
+    }
+}
+
+void PSCanvas::drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint8_t color) {
+    rect(x, y, width, height, fill, native(color));
+}
+
+void PSCanvas::drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint16_t color) {
+    rect(x, y, width, height, fill, native(color));
+}
+
+void PSCanvas::rect(int16_t x, int16_t y, int16_t w, int16_t h, boolean fill, uint16_t color) {
+    if (w <= 0 || h <= 0)
+        return;
+    sync();
+    int16_t x2 = x + w - 1;
+    int16_t y2 = y + h - 1;
+    if (fill) {
+        for (int16_t row = PS_max(y, originY); row <= y2 && row < originY + height; row++)
+            fillSpan(x, x2, row, color);
+    } else {
+        fillSpan(x, x2, y, color);
+        fillSpan(x, x2, y2, color);
+        for (int16_t row = y + 1; row < y2; row++) {
+            put(x, row, color);
+            put(x2, row, color);
+        }
+    }
+}
+
+void PSCanvas::drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint8_t color) {
+    ellipse(x, y, radius, radius, fill, native(color));
+}
+
+void PSCanvas::drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint16_t color) {
+    ellipse(x, y, radius, radius, fill, native(color));
+}
+
+void PSCanvas::drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint8_t color) {
+    ellipse(x, y, radiusX, radiusY, fill, native(color));
+}
+
+void PSCanvas::drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color) {
+    ellipse(x, y, radiusX, radiusY, fill, native(color));
+}
+
+void PSCanvas::drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint8_t color) {
+    PSVertex vertices[3] = {{x1, y1}, {x2, y2}, {x3, y3}};
+    polygon(vertices, 3, fill, native(color));
+}
+
+void PSCanvas::drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint16_t color) {
+    PSVertex vertices[3] = {{x1, y1}, {x2, y2}, {x3, y3}};
+    polygon(vertices, 3, fill, native(color));
+}
+
+void PSCanvas::drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint8_t color) {
+    polygon(vertices, numVertices, fill, native(color));
+}
+
+void PSCanvas::drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color) {
+    polygon(vertices, numVertices, fill, native(color));
+}
+
+void PSCanvas::ellipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color) {
+    sync();
+    PS_ellipseSpans(x, y, radiusX, radiusY, fill, color, originY, originY + height - 1, rasterSpan, this);
+}
+
+void PSCanvas::polygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color) {
+    sync();
+    if (fill)
+        PS_polygonSpans(vertices, numVertices, color, originY, originY + height - 1, rasterSpan, this);
+    else {
+        for (uint8_t i = 0; i < numVertices; i++) {
+            const PSVertex *next = &vertices[i + 1 < numVertices ? i + 1 : 0];
+            line(vertices[i].x, vertices[i].y, next->x, next->y, color);
+        }
+    }
+}
+
+void PSCanvas::rasterSpan(void *canvas, int16_t x1, int16_t x2, int16_t y, uint16_t color) {
+    ((PSCanvas *) canvas)->fillSpan(x1, x2, y, color);
+}
+
+void PSCanvas::drawImage(int16_t x, int16_t y, const PSImage *image) {
+    drawImageRegion(x, y, image, 0, 0, image->width, image->height);
+}
+
+void PSCanvas::drawFrame(int16_t x, int16_t y, const PSAtlas *atlas, uint8_t frame) {
+    const PSFrame *f = &atlas->frames[frame];
+    drawImageRegion(x, y, atlas->image, f->x, f->y, f->width, f->height);
+}
+
+void PSCanvas::drawImageRegion(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h) {
+    if (srcX >= image->width || srcY >= image->height)
+        return;
+    w = PS_min(w, image->width - srcX);
+    h = PS_min(h, image->height - srcY);
+    sync();
+    if (image->encoding == EncodingSpans) {
+        if (bitDepth16)
+            spanImageRows<PSFormatRGB565>(x, y, image, srcX, srcY, w, h);
+        else
+            spanImageRows<PSFormatRGB332>(x, y, image, srcX, srcY, w, h);
+    } else if (image->encoding != EncodingRaw || PS_isIndexed(image)) {
+        if (image->bitDepth == BitDepth16) {
+            if (bitDepth16)
+                decodedRows<PSFormatRGB565, PSFormatRGB565>(x, y, image, srcX, srcY, w, h);
+            else
+                decodedRows<PSFormatRGB565, PSFormatRGB332>(x, y, image, srcX, srcY, w, h);
+        } else {
+            if (bitDepth16)
+                decodedRows<PSFormatRGB332, PSFormatRGB565>(x, y, image, srcX, srcY, w, h);
+            else
+                decodedRows<PSFormatRGB332, PSFormatRGB332>(x, y, image, srcX, srcY, w, h);
+        }
+    } else if (image->bitDepth == BitDepth16) {
+        if (bitDepth16)
+            imageRows<PSFormatRGB565, PSFormatRGB565>(x, y, image, srcX, srcY, w, h);
+        else
+            imageRows<PSFormatRGB565, PSFormatRGB332>(x, y, image, srcX, srcY, w, h);
+    } else {
+        if (bitDepth16)
+            imageRows<PSFormatRGB332, PSFormatRGB565>(x, y, image, srcX, srcY, w, h);
+        else
+            imageRows<PSFormatRGB332, PSFormatRGB332>(x, y, image, srcX, srcY, w, h);
+    }
+}
+
+template <class Source, class Target> void PSCanvas::imageRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h) {
+    int16_t begin = PS_max(x, originX);
+    int16_t end = PS_min(x + w, originX + width);
+    if (begin >= end)
+        return;
+
+    for (int16_t row = PS_max(y, originY); row < y + h && row < originY + height; row++) {
+        const uint8_t *data = image->data + ((srcY + row - y) * image->width + srcX + begin - x) * Source::bytes;
+        uint8_t *p = buffer + ((row - originY) * width + begin - originX) * Target::bytes;
+        mark(begin - originX, end - 1 - originX, row - originY);
+        for (int16_t col = begin; col < end; col++) {
+            Target::store(p, PSConvert<Source, Target>::pixel(Source::load(data)));
+            data += Source::bytes;
+            p += Target::bytes;
+        }
+    }
+}
+
+// images made of spans, the gaps between the spans are left as they are
+template <class Target> void PSCanvas::spanImageRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h) {
+    int16_t begin = PS_max(x, originX);
+    int16_t end = PS_min(x + w, originX + width);
+    if (begin >= end)
+        return;
+
+    for (int16_t row = PS_max(y, originY); row < y + h && row < originY + height; row++) {
+        const uint8_t *p = PS_spanRow(image, srcY + row - y);
+        uint8_t *line = buffer + (row - originY) * width * Target::bytes;
+        mark(begin - originX, end - 1 - originX, row - originY);
+        uint8_t numSpans = *p++;
+        while (numSpans--) {
+            uint8_t column = p[0];
+            uint8_t length = p[1];
+            const uint8_t *pixels = p + 2;
+            p += 2 + length;
+            // the columns of the span on the canvas
+            int16_t first = PS_max(x + column - srcX, begin);
+            int16_t last = PS_min(x + column + length - srcX, end);
+            for (int16_t col = first; col < last; col++)
+                Target::store(line + (col - originX) * Target::bytes, Target::fromColor8(pixels[col - x + srcX - column]));
+        }
+    }
+}
+
+// compressed and indexed images are decoded in small pieces, rows above the canvas are skipped
+template <class Source, class Target> void PSCanvas::decodedRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h) {
+    int16_t begin = PS_max(x, originX);
+    int16_t end = PS_min(x + w, originX + width);
+    int16_t first = PS_max(y, originY);
+    int16_t last = PS_min(y + h, originY + height) - 1;
+    if (begin >= end || first > last)
+        return;
+
+    PSImageDecoder decoder(image);
+    uint8_t pixels[64];
+    decoder.skip(((uint32_t) srcY + first - y) * image->width + srcX + begin - x);
+    for (int16_t row = first; row <= last; row++) {
+        uint8_t *p = buffer + ((row - originY) * width + begin - originX) * Target::bytes;
+        mark(begin - originX, end - 1 - originX, row - originY);
+        for (int16_t col = begin; col < end; ) {
+            uint8_t n = PS_min(end - col, 64 / Source::bytes);
+            decoder.read(pixels, n);
+            for (uint8_t i = 0; i < n; i++) {
+                Target::store(p, PSConvert<Source, Target>::pixel(Source::load(pixels + i * Source::bytes)));
+                p += Target::bytes;
+            }
+            col += n;
+        }
+        if (row < last)
+            decoder.skip(image->width - (end - begin));
+    }
+}
+
+void PSCanvas::drawSprites(const PSSprite *sprites[], uint8_t numSprites) {
+    sync();
+    for (uint8_t i = 0; i < numSprites; i++) {
+        if (!sprites[i]->enabled)
+            continue;
+        if (bitDepth16)
+            spriteRows<PSFormatRGB565>(sprites[i]);
+        else
+            spriteRows<PSFormatRGB332>(sprites[i]);
+    }
+}
+
+template <class Target> void PSCanvas::spriteRows(const PSSprite *sprite) {
+    uint8_t spriteWidth = PS_spriteWidth(sprite);
+    uint8_t spriteHeight = PS_spriteHeight(sprite);
+    int16_t begin = PS_max(sprite->x, originX);
+    int16_t end = PS_min(sprite->x + spriteWidth, originX + width);
+    if (begin >= end)
+        return;
+
+    if (PS_spriteImage(sprite)->encoding == EncodingSpans) {
+        spanRows<Target>(sprite, begin, end);
+        return;
+    }
+
+    uint8_t colors[255];
+    boolean indexed = PS_isIndexed(PS_spriteImage(sprite));
+    for (int16_t row = PS_max(sprite->y, originY); row < sprite->y + spriteHeight && row < originY + height; row++) {
+        const uint8_t *data = PS_spriteData(sprite) + (row - sprite->y) * PS_spriteStride(sprite);
+        if (indexed) {
+            // indexed sprites are unpacked into colors a row at a time
+            PS_readIndexed(PS_spriteImage(sprite), PS_spriteOffset(sprite) + (row - sprite->y) * PS_spriteStride(sprite), spriteWidth, colors);
+            data = colors;
+        }
+        uint8_t *p = buffer + ((row - originY) * width + begin - originX) * Target::bytes;
+        mark(begin - originX, end - 1 - originX, row - originY);
+        for (int16_t col = begin; col < end; col++) {
+            // mirrored sprites are read from the right
+            uint8_t color = sprite->mirrorFlag ? data[sprite->x + spriteWidth - 1 - col] : data[col - sprite->x];
+            if (color != ALPHA)
+                Target::store(p, Target::fromColor8(color));
+            p += Target::bytes;
+        }
+    }
+}
+
+// sprites made of opaque spans, the columns begin to end - 1 of the canvas are drawn
+template <class Target> void PSCanvas::spanRows(const PSSprite *sprite, int16_t begin, int16_t end) {
+    uint8_t spriteWidth = PS_spriteWidth(sprite);
+    uint8_t left = PS_spriteLeft(sprite);
+    for (int16_t row = PS_max(sprite->y, originY); row < sprite->y + PS_spriteHeight(sprite) && row < originY + height; row++) {
+        const uint8_t *p = PS_spanRow(PS_spriteImage(sprite), PS_spriteTop(sprite) + row - sprite->y);
+        uint8_t *line = buffer + (row - originY) * width * Target::bytes;
+        mark(begin - originX, end - 1 - originX, row - originY);
+        uint8_t numSpans = *p++;
+        while (numSpans--) {
+            uint8_t column = p[0];
+            uint8_t length = p[1];
+            const uint8_t *pixels = p + 2;
+            p += 2 + length;
+            for (uint8_t i = 0; i < length; i++) {
+                // column in the frame, mirrored sprites are read from the right
+                int16_t c = column + i - left;
+                if (c < 0 || c >= spriteWidth)
+                    continue;
+                int16_t col = sprite->mirrorFlag ? sprite->x + spriteWidth - 1 - c : sprite->x + c;
+                if (col >= begin && col < end)
+                    Target::store(line + (col - originX) * Target::bytes, Target::fromColor8(pixels[i]));
+            }
+        }
+    }
+}
+
+void PSCanvas::copyWindow(int16_t srcX, int16_t srcY, int16_t width, int16_t height, int16_t dstX, int16_t dstY) {
+    copy(srcX, srcY, width, height, dstX, dstY, true);
+}
+
+// overlapping areas are fine, rows are copied in the right order
+void PSCanvas::copy(int16_t srcX, int16_t srcY, int16_t w, int16_t h, int16_t dstX, int16_t dstY, boolean dirty) {
+    sync();
+    srcX -= originX;
+    srcY -= originY;
+    dstX -= originX;
+    dstY -= originY;
+
+    // clip source and destination against the canvas
+    int16_t shift;
+    shift = PS_max(PS_max(-srcX, -dstX), 0);
+    srcX += shift; dstX += shift; w -= shift;
+    shift = PS_max(PS_max(-srcY, -dstY), 0);
+    srcY += shift; dstY += shift; h -= shift;
+    w = PS_min(w, width - PS_max(srcX, dstX));
+    h = PS_min(h, height - PS_max(srcY, dstY));
+    if (w <= 0 || h <= 0)
+        return;
+
+    uint8_t bytes = bitDepth16 ? 2 : 1;
+    for (int16_t i = 0; i < h; i++) {
+        int16_t row = dstY > srcY ? h - 1 - i : i;
+        memmove(buffer + ((dstY + row) * width + dstX) * bytes, buffer + ((srcY + row) * width + srcX) * bytes, w * bytes);
+        if (dirty)
+            mark(dstX, dstX + w - 1, dstY + row);
+    }
+}
+
+// moves every row up by the given number of rows modulo the height of the canvas, the rows at the top
+// come back in at the bottom. only used on a clean canvas, the dirty rows stay where they are
+void PSCanvas::rotate(int16_t rows) {
+    sync();
+    rows %= height;
+    if (rows < 0)
+        rows += height;
+    if (rows == 0)
+        return;
+
+    // three reversals, so no second buffer is needed
+    uint16_t rowBytes = bitDepth16 ? width << 1 : width;
+    reverse(0, rows, rowBytes);
+    reverse(rows, height, rowBytes);
+    reverse(0, height, rowBytes);
+}
+
+void PSCanvas::reverse(uint8_t first, uint8_t last, uint16_t rowBytes) {
+    while (first + 1 < last) {
+        last--;
+        uint8_t *a = buffer + first * rowBytes;
+        uint8_t *b = buffer + last * rowBytes;
+        for (uint16_t i = 0; i < rowBytes; i++) {
+            uint8_t temp = a[i];
+            a[i] = b[i];
+            b[i] = temp;
+        }
+        first++;
+    }
+}
+
+// printing text
+void PSCanvas::setFont(const PSFont &font) {
+    fontHeight = font.height;
+    fontFirstChar = font.startChar;
+    fontLastChar = font.endChar;
+    fontDescriptor = font.charInfo;
+    fontBitmap = font.bitmap;
+}
+
+void PSCanvas::setFontColor(uint16_t color, uint16_t colorBackground) {
+    fontColor = color;
+    fontColorBackground = colorBackground;
+}
+
+void PSCanvas::setCursor(int16_t x, int16_t y) {
+    cursorX = x;
+    cursorY = y;
+}
+
+uint8_t PSCanvas::getPrintWidth(char *text) {
+    if(!fontFirstChar)
+        return 0;
+    uint8_t charAmount, result = 0;
+    charAmount = strlen(text);
+    for(int i = 0; i < charAmount; i++) {
+        result += pgm_read_byte(&fontDescriptor[text[i] - fontFirstChar].width) + 1;
+    }
+    return result;
+}
+
+// same layout as PocketStar::write(): one background column on each side of the glyph
+size_t PSCanvas::write(uint8_t c) {
+    if (!fontFirstChar)
+        return 1;
+    if (c < fontFirstChar || c > fontLastChar)
+        return 1;
+    sync();
+
+    uint8_t charWidth = pgm_read_byte(&fontDescriptor[c - fontFirstChar].width);
+    uint8_t bytesPerRow = charWidth / 8;
+    if (charWidth > bytesPerRow * 8)
+        bytesPerRow++;
+    uint16_t offset = pgm_read_word(&fontDescriptor[c - fontFirstChar].offset) + (bytesPerRow * fontHeight) - 1;
+
+    if (bitDepth16)
+        glyph<PSFormatRGB565>(charWidth, bytesPerRow, offset);
+    else
+        glyph<PSFormatRGB332>(charWidth, bytesPerRow, offset);
+    cursorX += (charWidth + 1);
+    return 1;
+}
+
+template <class Target> void PSCanvas::glyph(uint8_t charWidth, uint8_t bytesPerRow, uint16_t offset) {
+    int16_t begin = PS_max(cursorX - originX, 0);
+    int16_t end = PS_min(cursorX + charWidth + 2 - originX, width);
+    if (begin >= end)
+        return;
+
+    for (uint8_t y = 0; y < fontHeight; y++) {
+        int16_t row = cursorY + y - originY;
+        if (row < 0 || row >= height)
+            continue;
+        uint8_t *p = buffer + (row * width + begin) * Target::bytes;
+        mark(begin, end - 1, row);
+        // column 0 and charWidth + 1 are background, the glyph bits are in between
+        for (int16_t col = begin; col < end; col++) {
+            int16_t bit = col + originX - cursorX - 1;
+            boolean set = false;
+            if (bit >= 0 && bit < charWidth) {
+                uint8_t byte = bit >> 3;
+                uint8_t data = pgm_read_byte(fontBitmap + offset - y - ((bytesPerRow - byte - 1) * fontHeight));
+                set = data & (0x80 >> (bit & 7));
+            }
+            Target::store(p, set ? fontColor : fontColorBackground);
+            p += Target::bytes;
+        }
+    }
+}
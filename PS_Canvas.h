@@ -0,0 +1,130 @@
+/*
+PS_Canvas.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PS_Canvas_h
+#define PS_Canvas_h
+
+#include <Print.h>
+#include "PS_Colors.h"
+#include "PS_FontDefinitions.h"
+#include "PS_Images.h"
+#include "PS_Decoder.h"
+#include "PS_Shapes.h"
+#include "PS_Sprites.h"
+
+// Offscreen image in RAM. Everything is drawn into the buffer and sent to the display with present().
+// The buffer is provided by the caller: width * height bytes in 8 bit mode, twice as much in 16 bit mode.
+// 16 bit pixels are stored high byte first, the way the display expects them.
+// The canvas can be up to 64 rows high.
+class PSCanvas : public Print {
+  public:
+    PSCanvas(uint8_t *buffer, uint8_t bitDepth, uint8_t width = 96, uint8_t height = 64);
+
+    uint8_t *getBuffer(void);
+    uint8_t getWidth(void);
+    uint8_t getHeight(void);
+    uint8_t getBitDepth(void);
+
+    // position of the top-left pixel in drawing coordinates, e.g. (0, 16) for a strip holding rows 16 to 31
+    void setOrigin(int16_t x, int16_t y);
+
+    // sends the whole canvas with a single window, (x, y) is the top-left corner on the display.
+    // the display is switched to the bit depth of the canvas while sending and back afterwards
+    void present(uint8_t x = 0, uint8_t y = 0);
+    // sends only the rows and columns changed since the last present() / flush()
+    void flush(uint8_t x = 0, uint8_t y = 0);
+    void markDirty(int16_t x, int16_t y, int16_t width, int16_t height);
+    boolean isDirty(void);
+
+    // drawing
+    void fillScreen(uint8_t color);
+    void fillScreen(uint16_t color);
+    void drawPixel(int16_t x, int16_t y, uint8_t color);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint8_t color);
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint16_t color);
+    void drawImage(int16_t x, int16_t y, const PSImage *image);
+    // draws the part of the image starting at (srcX, srcY), e.g. one frame of a sprite sheet
+    void drawImageRegion(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height);
+    void drawFrame(int16_t x, int16_t y, const PSAtlas *atlas, uint8_t frame);
+    void drawSprites(const PSSprite *sprites[], uint8_t numSprites);
+    void copyWindow(int16_t srcX, int16_t srcY, int16_t width, int16_t height, int16_t dstX, int16_t dstY);
+    void drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint8_t color);
+    void drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint16_t color);
+    void drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint8_t color);
+    void drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color);
+    void drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint8_t color);
+    void drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint16_t color);
+    // filled polygons have to be convex
+    void drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint8_t color);
+    void drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color);
+
+    // printing text
+    void setFont(const PSFont &font);
+    void setFontColor(uint16_t color, uint16_t colorBackground);
+    void setCursor(int16_t x, int16_t y);
+    uint8_t getPrintWidth(char *text);
+
+  private:
+    uint8_t *buffer;
+    uint8_t width, height;
+    boolean bitDepth16, presenting;
+    int16_t originX, originY;
+    int16_t cursorX, cursorY;
+    uint8_t fontHeight, fontFirstChar, fontLastChar;
+    uint16_t fontColor, fontColorBackground;
+    const PSCharInfo *fontDescriptor;
+    const unsigned char *fontBitmap;
+    // changed columns of each row, a row is clean if begin > end
+    uint8_t dirtyBegin[64], dirtyEnd[64];
+
+    void sync(void);
+    void send(uint8_t x, uint8_t y, uint8_t rows);
+    void mark(int16_t x1, int16_t x2, int16_t y);
+    void clean(void);
+    uint16_t native(uint8_t color);
+    uint16_t native(uint16_t color);
+    void put(int16_t x, int16_t y, uint16_t color);
+    void fillSpan(int16_t x1, int16_t x2, int16_t y, uint16_t color);
+    void line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void rect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint16_t color);
+    void ellipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color);
+    void polygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color);
+    static void rasterSpan(void *canvas, int16_t x1, int16_t x2, int16_t y, uint16_t color);
+    template <class Source, class Target> void imageRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h);
+    template <class Target> void spanImageRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h);
+    template <class Source, class Target> void decodedRows(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t w, uint8_t h);
+    template <class Target> void spriteRows(const PSSprite *sprite);
+    template <class Target> void spanRows(const PSSprite *sprite, int16_t begin, int16_t end);
+    template <class Target> void glyph(uint8_t charWidth, uint8_t bytesPerRow, uint16_t offset);
+    void copy(int16_t srcX, int16_t srcY, int16_t width, int16_t height, int16_t dstX, int16_t dstY, boolean dirty);
+    void rotate(int16_t rows);
+    void reverse(uint8_t first, uint8_t last, uint16_t rowBytes);
+    virtual size_t write(uint8_t c);
+
+    friend class PocketStar;
+    friend class PSDisplayList;
+};
+
+#endif
@@ -1,6 +1,6 @@
 /*
 PS_Colors.h
-Last modified 22 May 2018
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -61,4 +61,32 @@ const uint8_t DARKRED_8b        = 0x80;
 const uint8_t DARKGREEN_8b      = 0x10;
 const uint8_t DARKBLUE_8b       = 0x02;
 
+// conversion between 8 bit (RGB 332) and 16 bit (RGB 565) colors, evaluated at compile time for constants
+constexpr uint16_t PS_color16(uint8_t color) {
+    return ((((color >> 5) << 2) | (color >> 6)) << 11)
+         | (((((color >> 2) & 0x7) << 3) | ((color >> 2) & 0x7)) << 5)
+         | ((color & 0x3) << 3) | ((color & 0x3) << 1) | ((color & 0x3) >> 1);
+}
+
+constexpr uint8_t PS_color8(uint16_t color) {
+    return ((color >> 8) & 0xE0) | ((color >> 6) & 0x1C) | ((color >> 3) & 0x03);
+}
+
+// 6 bit channels of a 16 bit color, as used by the line and rectangle commands
+constexpr uint8_t PS_red6(uint16_t color) {
+    return ((color >> 10) & 0x3E) | (color >> 15);
+}
+
+constexpr uint8_t PS_green6(uint16_t color) {
+    return (color >> 5) & 0x3F;
+}
+
+constexpr uint8_t PS_blue6(uint16_t color) {
+    return ((color << 1) & 0x3E) | ((color >> 4) & 0x01);
+}
+
+constexpr uint16_t PS_rgbTo16(uint8_t red, uint8_t green, uint8_t blue) {
+    return ((red >> 1) << 11) | (green << 5) | (blue >> 1);
+}
+
 #endif
\ No newline at end of file
@@ -1,6 +1,6 @@
 /*
 PS_Commands.h
-Last modified 10 Jul 2018
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -26,11 +26,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define COMMAND_SET_COLOUMN     0x15
 #define COMMAND_DRAW_LINE       0x21
 #define COMMAND_DRAW_RECTANGLE  0x22
+#define COMMAND_COPY            0x23
+#define COMMAND_DIM_WINDOW      0x24
 #define COMMAND_CLEAR_WINDOW    0x25
 #define COMMAND_SET_FILL        0x26
+#define COMMAND_SCROLL_SETUP    0x27
+#define COMMAND_SCROLL_STOP     0x2E
+#define COMMAND_SCROLL_START    0x2F
 #define COMMAND_SET_ROW         0x75
+#define COMMAND_CONTRAST_A      0x81
+#define COMMAND_CONTRAST_B      0x82
+#define COMMAND_CONTRAST_C      0x83
 #define COMMAND_MASTER_CURRENT  0x87 // brightness
 #define COMMAND_SET_REMAP       0xA0
+#define COMMAND_START_LINE      0xA1
 #define COMMAND_DISPLAY_OFF     0xAE
 #define COMMAND_DISPLAY_ON      0xAF
 
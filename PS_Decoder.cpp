@@ -0,0 +1,229 @@
+/*
+PS_Decoder.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PS_Decoder.h"
+#include "PS_Internal.h"
+
+// palette indices to colors, a byte of indices at a time
+template <uint8_t Bits> static void PS_unpackIndices(uint8_t *buffer, const uint8_t *data, uint32_t first, uint16_t count, const uint8_t *palette) {
+    const uint8_t perByte = 8 / Bits;
+    const uint8_t mask = (1 << Bits) - 1;
+    data += first / perByte;
+    uint8_t k = first % perByte;
+    if (k > 0) {
+        // the rest of a byte which the previous pixels started
+        uint8_t b = *data++;
+        for (; k < perByte && count > 0; k++, count--)
+            *buffer++ = palette[(b >> (8 - Bits * (k + 1))) & mask];
+    }
+    for (; count >= perByte; count -= perByte) {
+        uint8_t b = *data++;
+        for (k = 0; k < perByte; k++)
+            *buffer++ = palette[(b >> (8 - Bits * (k + 1))) & mask];
+    }
+    for (k = 0; k < count; k++)
+        *buffer++ = palette[(*data >> (8 - Bits * (k + 1))) & mask];
+}
+
+static void PS_unpack(uint8_t bitsPerIndex, uint8_t *buffer, const uint8_t *data, uint32_t first, uint16_t count, const uint8_t *palette) {
+    if (bitsPerIndex == 1)
+        PS_unpackIndices<1>(buffer, data, first, count, palette);
+    else if (bitsPerIndex == 2)
+        PS_unpackIndices<2>(buffer, data, first, count, palette);
+    else
+        PS_unpackIndices<4>(buffer, data, first, count, palette);
+}
+
+void PS_readIndexed(const PSImage *image, uint32_t first, uint16_t count, uint8_t *buffer) {
+    PS_unpack(1 << (image->bitDepth - BitDepth1), buffer, image->data, first, count, image->palette);
+}
+
+PSImageDecoder::PSImageDecoder(void) {
+    data = NULL;
+    input = NULL;
+    encoding = EncodingRaw;
+    bytesPerPixel = 1;
+    bitsPerIndex = 0;
+    palette = NULL;
+    index = 0;
+    left = 0;
+    remaining = 0;
+    repeat = false;
+    position = 0;
+}
+
+PSImageDecoder::PSImageDecoder(const PSImage *image, Stream *input) {
+    begin(image, input);
+}
+
+void PSImageDecoder::begin(const PSImage *image, Stream *_input) {
+    data = image->data;
+    input = _input;
+    encoding = image->encoding;
+    bytesPerPixel = image->bitDepth == BitDepth16 ? 2 : 1;
+    bitsPerIndex = 0;
+    if (PS_isIndexed(image))
+        bitsPerIndex = 1 << (image->bitDepth - BitDepth1);
+    palette = image->palette;
+    index = 0;
+    left = 0;
+    remaining = image->width * image->height;
+    repeat = false;
+    position = 0;
+}
+
+uint8_t PSImageDecoder::fetch(void) {
+    if (input)
+        return input->read();
+    return *data++;
+}
+
+// copies bytes of the input, or drops them if buffer is NULL
+void PSImageDecoder::take(uint8_t *buffer, uint16_t count) {
+    if (input) {
+        if (buffer)
+            input->readBytes((char *) buffer, count);
+        else {
+            while (count--)
+                input->read();
+        }
+        return;
+    }
+    if (buffer)
+        memcpy(buffer, data, count);
+    data += count;
+}
+
+// starts the next packet
+void PSImageDecoder::next(void) {
+    uint8_t n = fetch();
+    repeat = n & 0x80;
+    if (encoding == EncodingLZ) {
+        if (repeat) {
+            left = (n & 0x7F) + 3;
+            source = position - 1 - fetch();
+        } else
+            left = n + 1;
+    } else {
+        left = (n & 0x7F) + 1;
+        if (repeat)
+            take(pixel, bytesPerPixel);
+    }
+}
+
+// decodes LZ bytes, every byte is remembered in the window
+void PSImageDecoder::unpack(uint8_t *buffer, uint32_t bytes) {
+    while (bytes > 0) {
+        if (left == 0)
+            next();
+        uint8_t n = PS_min(bytes, left);
+        bytes -= n;
+        left -= n;
+        while (n--) {
+            uint8_t b = repeat ? window[source++] : fetch();
+            window[position++] = b;
+            if (buffer)
+                *buffer++ = b;
+        }
+    }
+}
+
+void PSImageDecoder::read(uint8_t *buffer, uint16_t count) {
+    remaining -= count;
+    if (bitsPerIndex) {
+        PS_unpack(bitsPerIndex, buffer, data, index, count, palette);
+        index += count;
+        return;
+    }
+    if (encoding == EncodingRaw) {
+        take(buffer, count * bytesPerPixel);
+        return;
+    }
+    if (encoding == EncodingLZ) {
+        unpack(buffer, count * bytesPerPixel);
+        return;
+    }
+    while (count > 0) {
+        if (left == 0)
+            next();
+        uint8_t n = PS_min(count, left);
+        if (!repeat)
+            take(buffer, n * bytesPerPixel);
+        else if (bytesPerPixel == 1)
+            memset(buffer, pixel[0], n);
+        else
+            PSFormatRGB565::fill(buffer, PSFormatRGB565::load(pixel), n);
+        buffer += n * bytesPerPixel;
+        count -= n;
+        left -= n;
+    }
+}
+
+void PSImageDecoder::skip(uint32_t count) {
+    remaining -= count;
+    if (bitsPerIndex) {
+        index += count;
+        return;
+    }
+    if (encoding == EncodingRaw) {
+        while (count > 0) {
+            uint16_t n = PS_min(count, 0x4000);
+            take(NULL, n * bytesPerPixel);
+            count -= n;
+        }
+        return;
+    }
+    if (encoding == EncodingLZ) {
+        unpack(NULL, count * bytesPerPixel);
+        return;
+    }
+    while (count > 0) {
+        if (left == 0)
+            next();
+        uint8_t n = PS_min(count, left);
+        if (!repeat)
+            take(NULL, n * bytesPerPixel);
+        count -= n;
+        left -= n;
+    }
+}
+
+uint32_t PSImageDecoder::run(void) {
+    if (encoding != EncodingRLE || bitsPerIndex)
+        return 0;
+    if (left == 0)
+        next();
+    if (!repeat)
+        return 0;
+    // long runs are split into several packets, the following packets can only be looked at in memory
+    uint32_t length = left;
+    const uint8_t *p = data;
+    while (!input && length < remaining && (p[0] & 0x80) && memcmp(p + 1, pixel, bytesPerPixel) == 0) {
+        length += (p[0] & 0x7F) + 1;
+        p += 1 + bytesPerPixel;
+    }
+    return length;
+}
+
+uint16_t PSImageDecoder::runPixel(void) {
+    return bytesPerPixel == 2 ? PSFormatRGB565::load(pixel) : pixel[0];
+}
@@ -0,0 +1,81 @@
+/*
+PS_Decoder.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PS_Decoder_h
+#define PS_Decoder_h
+
+#include <Arduino.h>
+#include <Stream.h>
+#include "PS_Images.h"
+
+// Reads the pixels of an image in order, row after row, without decompressing the whole image.
+// Pixels are copied in the image's bit depth, 16 bit pixels high byte first.
+// The bytes come from the image's data or from a stream, e.g. a file on the SD card.
+//
+// EncodingRLE: a sequence of packets. The first byte n of a packet is either
+//   n < 0x80:  n + 1 pixels follow
+//   n >= 0x80: the following pixel is repeated n - 0x7F times
+// EncodingLZ: the same, but for bytes instead of pixels, and instead of a run
+//   n >= 0x80: n - 0x7D bytes are copied from d + 1 bytes back, d is the following byte
+//   the decoder keeps the last 256 bytes for this.
+// Packets may continue on the next row. extra/encode_images.py compresses the images of a sketch.
+//
+// Indexed images are read as 8 bit colors, the indices are looked up in the palette. They can't be read from a stream.
+class PSImageDecoder {
+  public:
+    PSImageDecoder(void);
+    PSImageDecoder(const PSImage *image, Stream *input = NULL);
+
+    // starts again at the first pixel of the image. with an input, the data pointer of the image is not used
+    void begin(const PSImage *image, Stream *input = NULL);
+
+    void read(uint8_t *buffer, uint16_t count);
+    void skip(uint32_t count);
+    // number of times the next pixel is repeated, following runs of the same pixel included. 0 if it is not repeated
+    uint32_t run(void);
+    // the repeated pixel of the current run
+    uint16_t runPixel(void);
+
+  private:
+    const uint8_t *data;
+    Stream *input;
+    uint8_t encoding, bytesPerPixel, bitsPerIndex;
+    const uint8_t *palette;
+    uint32_t index;
+    // pixels (RLE) or bytes (LZ) left in the current packet
+    uint8_t left;
+    uint32_t remaining;
+    boolean repeat;
+    uint8_t pixel[2];
+    uint8_t window[256];
+    uint8_t position, source;
+
+    uint8_t fetch(void);
+    void take(uint8_t *buffer, uint16_t count);
+    void next(void);
+    void unpack(uint8_t *buffer, uint32_t bytes);
+};
+
+// colors of the pixels first to first + count - 1 of an indexed image, which is never compressed
+void PS_readIndexed(const PSImage *image, uint32_t first, uint16_t count, uint8_t *buffer);
+
+#endif
@@ -0,0 +1,461 @@
+/*
+PS_DisplayList.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PocketStar.h"
+#include "PS_DisplayList.h"
+#include "PS_Internal.h"
+
+// flags in the type byte, only used while submitting
+#define PS_COMMAND_SKIP 0x80
+#define PS_COMMAND_DONE 0x40
+#define PS_COMMAND_TYPE 0x3F
+
+// opaque boxes submit() keeps while culling
+const uint8_t PS_OCCLUDERS = 8;
+
+// bounding box of a command, clipped to the display
+static void PS_commandBox(const PSDisplayCommand *command, int16_t &x1, int16_t &y1, int16_t &x2, int16_t &y2) {
+    x1 = PS_max(PS_min(command->x1, command->x2), 0);
+    y1 = PS_max(PS_min(command->y1, command->y2), 0);
+    x2 = PS_min(PS_max(command->x1, command->x2), PocketStar::xMax);
+    y2 = PS_min(PS_max(command->y1, command->y2), PocketStar::yMax);
+}
+
+// commands which paint every pixel of their bounding box. text leaves the last column of its box alone,
+// span images only paint their spans and sprites are left alone as well
+static boolean PS_commandOpaque(const PSDisplayCommand *command) {
+    switch (command->type & PS_COMMAND_TYPE) {
+        case PSCommandRect:
+            return command->param;
+        case PSCommandImage:
+            return ((const PSImage *) command->data)->encoding != EncodingSpans;
+    }
+    return false;
+}
+
+// true if the box (x1, y1, x2, y2) shares a pixel with the box b, an empty b (b[0] > b[2]) shares none
+static boolean PS_boxesOverlap(int16_t x1, int16_t y1, int16_t x2, int16_t y2, const int16_t *b) {
+    return b[0] <= x2 && x1 <= b[2] && b[1] <= y2 && y1 <= b[3];
+}
+
+static int32_t PS_boxArea(const int16_t *b) {
+    return (int32_t) (b[2] - b[0] + 1) * (b[3] - b[1] + 1);
+}
+
+// bit depth the display has to be in, 0xFF if it does not matter
+static uint8_t PS_commandBitDepth(const PSDisplayCommand *command) {
+    switch (command->type & PS_COMMAND_TYPE) {
+        case PSCommandImage:
+            // indexed images are drawn in either bit depth
+            if (PS_isIndexed((const PSImage *) command->data))
+                return 0xFF;
+            return ((const PSImage *) command->data)->bitDepth;
+        case PSCommandSprites:
+            return BitDepth8;
+    }
+    return 0xFF;
+}
+
+PSDisplayList::PSDisplayList(PSDisplayCommand *_commands, uint8_t _capacity) {
+    commands = _commands;
+    capacity = _capacity;
+    count = 0;
+    background = BLACK_16b;
+    font = NULL;
+    fontColor = WHITE_16b;
+    fontColorBackground = BLACK_16b;
+}
+
+void PSDisplayList::clear(void) {
+    count = 0;
+}
+
+uint8_t PSDisplayList::size(void) {
+    return count;
+}
+
+boolean PSDisplayList::isFull(void) {
+    return count >= capacity;
+}
+
+void PSDisplayList::setBackground(uint8_t color) {
+    background = PS_color16(color);
+}
+
+void PSDisplayList::setBackground(uint16_t color) {
+    background = color;
+}
+
+PSDisplayCommand *PSDisplayList::add(uint8_t type, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    if (count >= capacity)
+        return NULL;
+    PSDisplayCommand *command = &commands[count++];
+    command->type = type;
+    command->param = 0;
+    command->x1 = x1;
+    command->y1 = y1;
+    command->x2 = x2;
+    command->y2 = y2;
+    command->color = color;
+    command->colorBackground = 0;
+    command->data = NULL;
+    command->font = NULL;
+    return command;
+}
+
+// recording
+void PSDisplayList::drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint8_t color) {
+    drawRect(x, y, width, height, fill, PS_color16(color));
+}
+
+void PSDisplayList::drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint16_t color) {
+    if (width <= 0 || height <= 0)
+        return;
+    PSDisplayCommand *command = add(PSCommandRect, x, y, x + width - 1, y + height - 1, color);
+    if (command)
+        command->param = fill;
+}
+
+void PSDisplayList::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color) {
+    add(PSCommandLine, x1, y1, x2, y2, PS_color16(color));
+}
+
+void PSDisplayList::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    add(PSCommandLine, x1, y1, x2, y2, color);
+}
+
+void PSDisplayList::drawPixel(int16_t x, int16_t y, uint8_t color) {
+    add(PSCommandPixel, x, y, x, y, PS_color16(color));
+}
+
+void PSDisplayList::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    add(PSCommandPixel, x, y, x, y, color);
+}
+
+void PSDisplayList::drawImage(int16_t x, int16_t y, const PSImage *image) {
+    PSDisplayCommand *command = add(PSCommandImage, x, y, x + image->width - 1, y + image->height - 1, 0);
+    if (command)
+        command->data = image;
+}
+
+// sprites are read when rendering, so they can still be moved after recording
+void PSDisplayList::drawSprites(const PSSprite *sprites[], uint8_t numSprites) {
+    PSDisplayCommand *command = add(PSCommandSprites, 0, 0, PocketStar::xMax, PocketStar::yMax, 0);
+    if (command) {
+        command->param = numSprites;
+        command->data = sprites;
+    }
+}
+
+void PSDisplayList::setFont(const PSFont &_font) {
+    font = &_font;
+}
+
+void PSDisplayList::setFontColor(uint8_t color, uint8_t colorBackground) {
+    fontColor = PS_color16(color);
+    fontColorBackground = PS_color16(colorBackground);
+}
+
+void PSDisplayList::setFontColor(uint16_t color, uint16_t colorBackground) {
+    fontColor = color;
+    fontColorBackground = colorBackground;
+}
+
+void PSDisplayList::drawText(int16_t x, int16_t y, const char *text) {
+    if (!font)
+        return;
+    int16_t width = 1;
+    for (const char *c = text; *c; c++) {
+        if (*c >= font->startChar && *c <= font->endChar)
+            width += pgm_read_byte(&font->charInfo[*c - font->startChar].width) + 1;
+    }
+    // nothing would be printed, but the box would cover what is below
+    if (width == 1)
+        return;
+    PSDisplayCommand *command = add(PSCommandText, x, y, x + width - 1, y + font->height - 1, fontColor);
+    if (command) {
+        command->colorBackground = fontColorBackground;
+        command->data = text;
+        command->font = font;
+    }
+}
+
+// replay
+void PSDisplayList::replay(PSCanvas &canvas) {
+    int16_t top = canvas.originY;
+    int16_t bottom = canvas.originY + canvas.height - 1;
+
+    for (uint8_t i = 0; i < count; i++) {
+        const PSDisplayCommand *command = &commands[i];
+        if (PS_max(command->y1, command->y2) < top || PS_min(command->y1, command->y2) > bottom)
+            continue;
+
+        switch (command->type) {
+            case PSCommandRect:
+                canvas.drawRect(command->x1, command->y1, command->x2 - command->x1 + 1, command->y2 - command->y1 + 1, command->param, command->color);
+                break;
+            case PSCommandLine:
+                canvas.drawLine(command->x1, command->y1, command->x2, command->y2, command->color);
+                break;
+            case PSCommandPixel:
+                canvas.drawPixel(command->x1, command->y1, command->color);
+                break;
+            case PSCommandImage:
+                canvas.drawImage(command->x1, command->y1, (const PSImage *) command->data);
+                break;
+            case PSCommandSprites:
+                canvas.drawRect(0, 0, 96, 64, true, PS_color8(background));
+                canvas.drawSprites((const PSSprite **) command->data, command->param);
+                break;
+            case PSCommandText:
+                text(canvas, command);
+                break;
+        }
+    }
+}
+
+void PSDisplayList::text(PSCanvas &canvas, const PSDisplayCommand *command) {
+    canvas.setFont(*command->font);
+    canvas.setFontColor(canvas.native(command->color), canvas.native(command->colorBackground));
+    canvas.setCursor(command->x1, command->y1);
+    canvas.print((const char *) command->data);
+}
+
+// submitting to the display
+void PSDisplayList::submit(void) {
+    // cull commands outside of the display or covered by a later opaque one. the list is walked backwards
+    // once, the largest opaque boxes seen so far are kept as occluders
+    int16_t occluders[PS_OCCLUDERS][4];
+    uint8_t numOccluders = 0;
+    boolean backgroundVisible = true;
+    for (uint8_t i = count; i-- > 0;) {
+        int16_t x1, y1, x2, y2;
+        PS_commandBox(&commands[i], x1, y1, x2, y2);
+        boolean covered = x1 > x2 || y1 > y2;
+        for (uint8_t j = 0; j < numOccluders && !covered; j++)
+            covered = occluders[j][0] <= x1 && occluders[j][1] <= y1 && occluders[j][2] >= x2 && occluders[j][3] >= y2;
+        if (covered) {
+            commands[i].type |= PS_COMMAND_SKIP;
+            continue;
+        }
+        if (!PS_commandOpaque(&commands[i]))
+            continue;
+        if (x1 == 0 && y1 == 0 && x2 == PocketStar::xMax && y2 == PocketStar::yMax)
+            backgroundVisible = false;
+        // a full list gives up its smallest box, if this one is larger
+        uint8_t slot = numOccluders;
+        if (numOccluders == PS_OCCLUDERS) {
+            slot = 0;
+            for (uint8_t j = 1; j < PS_OCCLUDERS; j++) {
+                if (PS_boxArea(occluders[j]) < PS_boxArea(occluders[slot]))
+                    slot = j;
+            }
+            if ((int32_t) (x2 - x1 + 1) * (y2 - y1 + 1) <= PS_boxArea(occluders[slot]))
+                continue;
+        } else {
+            numOccluders++;
+        }
+        occluders[slot][0] = x1;
+        occluders[slot][1] = y1;
+        occluders[slot][2] = x2;
+        occluders[slot][3] = y2;
+    }
+    
+    uint8_t bitDepth = pocketstar.bitDepth16 ? BitDepth16 : BitDepth8;
+    pocketstar.beginBatch();
+    if (backgroundVisible)
+        pocketstar.drawRect(0, 0, 96, 64, true, background);
+    
+    // each pass walks the list once and draws what it can in the current bit depth. a command in the other
+    // bit depth is left for a later pass, and so is everything after it which overlaps the commands left
+    while (true) {
+        uint8_t current = pocketstar.bitDepth16 ? BitDepth16 : BitDepth8;
+        int16_t blocked[4] = {1, 1, 0, 0};
+        uint8_t first = 0xFF;
+        boolean drawn = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (commands[i].type & (PS_COMMAND_SKIP | PS_COMMAND_DONE))
+                continue;
+            int16_t x1, y1, x2, y2;
+            PS_commandBox(&commands[i], x1, y1, x2, y2);
+            uint8_t depth = PS_commandBitDepth(&commands[i]);
+            // with the color expansion a bit depth change costs nothing
+            boolean depthOk = depth == 0xFF || depth == current || pocketstar.expansion;
+            if (!depthOk || PS_boxesOverlap(x1, y1, x2, y2, blocked)) {
+                if (first == 0xFF) {
+                    first = i;
+                    blocked[0] = x1;
+                    blocked[1] = y1;
+                    blocked[2] = x2;
+                    blocked[3] = y2;
+                } else {
+                    blocked[0] = PS_min(blocked[0], x1);
+                    blocked[1] = PS_min(blocked[1], y1);
+                    blocked[2] = PS_max(blocked[2], x2);
+                    blocked[3] = PS_max(blocked[3], y2);
+                }
+                continue;
+            }
+            emit(i, blocked);
+            drawn = true;
+        }
+        if (first == 0xFF)
+            break;
+        // nothing was left for this bit depth, the first command waiting does not wait for anything
+        if (!drawn) {
+            const int16_t none[4] = {1, 1, 0, 0};
+            emit(first, none);
+        }
+    }
+    
+    for (uint8_t i = 0; i < count; i++)
+        commands[i].type &= PS_COMMAND_TYPE;
+    if (pocketstar.bitDepth16 != (bitDepth == BitDepth16))
+        pocketstar.setBitDepth(bitDepth);
+    pocketstar.endBatch();
+}
+
+// draws a command, commands left for later passes cover the box blocked
+void PSDisplayList::emit(uint8_t index, const int16_t *blocked) {
+    PSDisplayCommand *command = &commands[index];
+    command->type |= PS_COMMAND_DONE;
+    int16_t x1, y1, x2, y2;
+    PS_commandBox(command, x1, y1, x2, y2);
+    
+    switch (command->type & PS_COMMAND_TYPE) {
+        case PSCommandRect: {
+            if (command->param) {
+                // grow the rectangle by the filled rectangles of the same color recorded right after it
+                // which touch it along a whole edge and don't have to wait for a command left for later
+                for (uint8_t i = index + 1; i < count; i++) {
+                    PSDisplayCommand *other = &commands[i];
+                    if (other->type & (PS_COMMAND_SKIP | PS_COMMAND_DONE))
+                        continue;
+                    if ((other->type & PS_COMMAND_TYPE) != PSCommandRect || !other->param || other->color != command->color)
+                        break;
+                    int16_t ox1, oy1, ox2, oy2;
+                    PS_commandBox(other, ox1, oy1, ox2, oy2);
+                    boolean rows = oy1 == y1 && oy2 == y2 && (ox1 == x2 + 1 || ox2 == x1 - 1);
+                    boolean columns = ox1 == x1 && ox2 == x2 && (oy1 == y2 + 1 || oy2 == y1 - 1);
+                    if ((!rows && !columns) || PS_boxesOverlap(ox1, oy1, ox2, oy2, blocked))
+                        break;
+                    other->type |= PS_COMMAND_DONE;
+                    x1 = PS_min(x1, ox1);
+                    y1 = PS_min(y1, oy1);
+                    x2 = PS_max(x2, ox2);
+                    y2 = PS_max(y2, oy2);
+                }
+            } else if (x1 != command->x1 || y1 != command->y1 || x2 != command->x2 || y2 != command->y2) {
+                // an outline partly off the screen: only the edges on the screen are drawn, the clipped box has no edges of its own
+                if (command->y1 >= 0)
+                    pocketstar.drawRect(x1, y1, x2 - x1 + 1, 1, true, command->color);
+                if (command->y2 <= PocketStar::yMax)
+                    pocketstar.drawRect(x1, y2, x2 - x1 + 1, 1, true, command->color);
+                if (command->x1 >= 0)
+                    pocketstar.drawRect(x1, y1, 1, y2 - y1 + 1, true, command->color);
+                if (command->x2 <= PocketStar::xMax)
+                    pocketstar.drawRect(x2, y1, 1, y2 - y1 + 1, true, command->color);
+                break;
+            }
+            pocketstar.drawRect(x1, y1, x2 - x1 + 1, y2 - y1 + 1, command->param, command->color);
+            break;
+        }
+        case PSCommandLine:
+            pocketstar.drawLine(command->x1, command->y1, command->x2, command->y2, command->color);
+            break;
+        case PSCommandPixel:
+            if (pocketstar.bitDepth16)
+                pocketstar.drawPixel(x1, y1, command->color);
+            else
+                pocketstar.drawPixel(x1, y1, (uint16_t) PS_color8(command->color));
+            break;
+        case PSCommandImage: {
+            const PSImage *image = (const PSImage *) command->data;
+            if (!PS_isIndexed(image) && pocketstar.bitDepth16 != (image->bitDepth == BitDepth16))
+                pocketstar.setBitDepth(image->bitDepth);
+            pocketstar.drawImage(command->x1, command->y1, image);
+            break;
+        }
+        case PSCommandSprites:
+            if (pocketstar.bitDepth16)
+                pocketstar.setBitDepth(BitDepth8);
+            pocketstar.drawSprites((const PSSprite **) command->data, command->param, PS_color8(background));
+            break;
+        case PSCommandText:
+            if (command->x1 < 0 || command->y1 < 0) {
+                clippedText(command, x1, y1, x2, y2);
+                break;
+            }
+            pocketstar.setFont(*command->font);
+            if (pocketstar.bitDepth16)
+                pocketstar.setFontColor(command->color, command->colorBackground);
+            else
+                pocketstar.setFontColor(PS_color8(command->color), PS_color8(command->colorBackground));
+            pocketstar.setCursor(command->x1, command->y1);
+            pocketstar.print((const char *) command->data);
+            break;
+    }
+}
+
+// the display cursor can't be left of or above the screen, such text is printed into a small canvas and sent from there
+void PSDisplayList::clippedText(const PSDisplayCommand *command, int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+    if (pocketstar.shadow) {
+        text(*pocketstar.shadow, command);
+        return;
+    }
+    uint8_t buffer[192];
+    uint8_t width = x2 - x1 + 1;
+    uint8_t rows = sizeof(buffer) / (width * (pocketstar.bitDepth16 ? 2 : 1));
+    for (int16_t y = y1; y <= y2; y += rows) {
+        PSCanvas strip(buffer, pocketstar.bitDepth16 ? BitDepth16 : BitDepth8, width, PS_min(rows, y2 + 1 - y));
+        strip.setOrigin(x1, y);
+        text(strip, command);
+        strip.send(x1, y, strip.height);
+        // the buffer is used again for the next rows
+        pocketstar.waitForTransfer();
+    }
+}
+
+void PSDisplayList::render(PSCanvas &strip) {
+    render(strip, strip);
+}
+
+void PSDisplayList::render(PSCanvas &strip, PSCanvas &nextStrip) {
+    PSCanvas *current = &strip;
+    PSCanvas *next = &nextStrip;
+    boolean depth16 = pocketstar.bitDepth16;
+
+    for (int16_t y = 0; y <= PocketStar::yMax; y += current->height) {
+        current->setOrigin(0, y);
+        current->fillScreen(background);
+        replay(*current);
+        current->send(0, y, PS_min(current->height, PocketStar::yMax + 1 - y));
+        current->clean();
+
+        PSCanvas *swap = current;
+        current = next;
+        next = swap;
+    }
+    // the strips are sent in their own bit depth, the caller's is kept
+    if (pocketstar.bitDepth16 != depth16)
+        pocketstar.setBitDepth(depth16 ? BitDepth16 : BitDepth8);
+}
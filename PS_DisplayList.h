@@ -0,0 +1,100 @@
+/*
+PS_DisplayList.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PS_DisplayList_h
+#define PS_DisplayList_h
+
+#include "PS_Canvas.h"
+
+const uint8_t PSCommandRect     = 0;
+const uint8_t PSCommandLine     = 1;
+const uint8_t PSCommandPixel    = 2;
+const uint8_t PSCommandImage    = 3;
+const uint8_t PSCommandSprites  = 4;
+const uint8_t PSCommandText     = 5;
+
+// one recorded drawing call, colors are stored as 16 bit
+typedef struct {
+    uint8_t         type;
+    uint8_t         param;      // rect: fill, sprites: number of sprites
+    int16_t         x1, y1;     // bounding box (lines: end points)
+    int16_t         x2, y2;
+    uint16_t        color;
+    uint16_t        colorBackground;
+    const void      *data;      // image, sprite list or text
+    const PSFont    *font;
+} PSDisplayCommand;
+
+// Records drawing calls and replays them later. The command array is provided by the caller.
+// Images, sprites, texts and fonts are stored by pointer and have to stay valid until rendering.
+// Sprites are a layer covering the whole screen, like PocketStar::drawSprites() they are composed over the
+// background color (in 8 bit) and hide everything recorded before them. submit() and render() agree on that.
+class PSDisplayList {
+  public:
+    PSDisplayList(PSDisplayCommand *commands, uint8_t capacity);
+
+    void clear(void);
+    uint8_t size(void);
+    boolean isFull(void);
+    void setBackground(uint8_t color);
+    void setBackground(uint16_t color);
+
+    // recording
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint8_t color);
+    void drawRect(int16_t x, int16_t y, int16_t width, int16_t height, boolean fill, uint16_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void drawPixel(int16_t x, int16_t y, uint8_t color);
+    void drawPixel(int16_t x, int16_t y, uint16_t color);
+    void drawImage(int16_t x, int16_t y, const PSImage *image);
+    void drawSprites(const PSSprite *sprites[], uint8_t numSprites);
+    void setFont(const PSFont &font);
+    void setFontColor(uint8_t color, uint8_t colorBackground);
+    void setFontColor(uint16_t color, uint16_t colorBackground);
+    void drawText(int16_t x, int16_t y, const char *text);
+
+    // replays everything into the canvas, drawing coordinates are those of the canvas origin
+    void replay(PSCanvas &canvas);
+    // draws the whole screen strip by strip: each strip is cleared, replayed into and sent.
+    // with a second strip, one strip is drawn while the other one is sent
+    void render(PSCanvas &strip);
+    void render(PSCanvas &strip, PSCanvas &nextStrip);
+    // draws the list directly on the display. commands completely covered by later ones are skipped,
+    // filled rectangles next to each other are merged and independent commands are reordered to save
+    // bit depth changes.
+    // the list is kept, so a static screen can be submitted again after resume()
+    void submit(void);
+
+  private:
+    PSDisplayCommand *commands;
+    uint8_t capacity, count;
+    uint16_t background;
+    const PSFont *font;
+    uint16_t fontColor, fontColorBackground;
+
+    PSDisplayCommand *add(uint8_t type, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void emit(uint8_t index, const int16_t *blocked);
+    void text(PSCanvas &canvas, const PSDisplayCommand *command);
+    void clippedText(const PSDisplayCommand *command, int16_t x1, int16_t y1, int16_t x2, int16_t y2);
+};
+
+#endif
@@ -1,6 +1,6 @@
 /*
 PS_Images.h
-Last modified 22 May 2018
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -25,12 +25,43 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 const uint8_t BitDepth8 = 0;
 const uint8_t BitDepth16 = 1;
+// indexed images: each pixel is an index into the palette of 8 bit colors. the indices are packed
+// into bytes, first pixel in the highest bits, and rows continue in the same byte
+const uint8_t BitDepth1 = 2;
+const uint8_t BitDepth2 = 3;
+const uint8_t BitDepth4 = 4;
+
+// how the pixels are stored, see PS_Decoder.h for the compressed formats
+const uint8_t EncodingRaw = 0;
+const uint8_t EncodingRLE = 1;
+const uint8_t EncodingLZ = 2;
+// only for sprites: the opaque pixels of each row, see PS_Sprites.h
+const uint8_t EncodingSpans = 3;
 
 typedef struct {
     uint8_t         width;
     uint8_t         height;
     uint8_t         bitDepth;
     const uint8_t   *data;
+    uint8_t         encoding;
+    const uint8_t   *palette;   // only for indexed images, which are always stored raw
 } PSImage;
 
+inline boolean PS_isIndexed(const PSImage *image) {
+    return image->bitDepth >= BitDepth1;
+}
+
+// part of an atlas image
+typedef struct {
+    uint8_t         x, y;
+    uint8_t         width, height;
+} PSFrame;
+
+// several frames in one image, e.g. the steps of an animation. frames are drawn straight from the image
+typedef struct {
+    const PSImage   *image;
+    const PSFrame   *frames;
+    uint8_t         numFrames;
+} PSAtlas;
+
 #endif
\ No newline at end of file
@@ -0,0 +1,127 @@
+/*
+PS_Internal.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// helpers shared by the library sources, not meant to be included by sketches
+
+#ifndef PS_Internal_h
+#define PS_Internal_h
+
+#include "PS_Colors.h"
+#include "PS_Transfer.h"
+
+#ifndef PS_HOST
+#define PS_send(x) SERCOM4->SPI.DATA.bit.DATA = (x);
+#define PS_wait() while (SERCOM4->SPI.INTFLAG.bit.DRE == 0);
+// waits until the last byte is shifted out and drops the bytes received meanwhile
+#define PS_finish() { while (SERCOM4->SPI.INTFLAG.bit.TXC == 0); while (SERCOM4->SPI.INTFLAG.bit.RXC) SERCOM4->SPI.DATA.reg; SERCOM4->SPI.STATUS.bit.BUFOVF = 1; }
+
+// chip select (PA13) and data / command (PA12) of the display, set directly in the port registers
+#define PS_select() PORT->Group[0].OUTCLR.reg = PORT_PA13;
+#define PS_deselect() PORT->Group[0].OUTSET.reg = PORT_PA13;
+#define PS_commandMode() PORT->Group[0].OUTCLR.reg = PORT_PA12;
+#define PS_dataMode() PORT->Group[0].OUTSET.reg = PORT_PA12;
+#else
+// host build: the bytes and the data / command line go to the sink of PSTransfer
+#define PS_send(x) PSTransfer::hostSend(x);
+#define PS_wait() ((void) 0);
+#define PS_finish() ((void) 0);
+#define PS_select() ((void) 0);
+#define PS_deselect() ((void) 0);
+#define PS_commandMode() PSTransfer::hostCommandMode(true);
+#define PS_dataMode() PSTransfer::hostCommandMode(false);
+#endif
+#define PS_max(x, y) (((x) > (y)) ? (x) : (y))
+#define PS_min(x, y) (((x) < (y)) ? (x) : (y))
+
+// drawing time of the accelerated graphics commands: a fixed setup time plus the pixels written, but never
+// less than PS_COMMAND_MIN_TIME. the rate is an estimate, not a measurement: the floor is the 100 µs
+// version 1.0.2 waited after every line, and a full screen rectangle (448 µs) still takes longer than
+// the 400 µs it waited after every rectangle. a sketch can override the constants after measuring
+#ifndef PS_COMMAND_MIN_TIME
+#define PS_COMMAND_MIN_TIME 100    // µs
+#endif
+#ifndef PS_COMMAND_SETUP_TIME
+#define PS_COMMAND_SETUP_TIME 10    // µs
+#endif
+#ifndef PS_COMMAND_PIXELS_PER_US
+#define PS_COMMAND_PIXELS_PER_US 14
+#endif
+#define PS_commandTime(pixels) PS_max(PS_COMMAND_MIN_TIME, PS_COMMAND_SETUP_TIME + (pixels) / PS_COMMAND_PIXELS_PER_US)
+// pixels are drawn as a rectangle when sending them would take longer than the rectangle command (11 bytes)
+// and its drawing time. a byte takes 2/3 µs at 12 MHz, the window for the pixels 6 bytes. with the default
+// model that is from 78 pixels in 16 bit mode and from 156 pixels in 8 bit mode
+#define PS_rectFaster(pixels, bytesPerPixel) ((((int32_t) (pixels)) * (bytesPerPixel) + 6) * 2 > 11 * 2 + 3 * PS_commandTime((int32_t) (pixels)))
+
+// pixel formats of the blit kernels. a kernel is a template over the format, the format is chosen once per
+// call, so the inner loops do not test the bit depth. pixels are passed as uint16_t in the format's encoding
+struct PSFormatRGB332 {
+    static const uint8_t bytes = 1;
+    static inline uint16_t fromColor8(uint8_t color) { return color; }
+    static inline uint16_t fromColor16(uint16_t color) { return PS_color8(color); }
+    static inline uint16_t toColor16(uint16_t pixel) { return PS_color16(pixel); }
+    static inline uint16_t load(const uint8_t *p) { return *p; }
+    static inline void store(uint8_t *p, uint16_t pixel) { *p = pixel; }
+    static inline void fill(uint8_t *p, uint16_t pixel, uint16_t count) { memset(p, pixel, count); }
+    static inline void send(uint16_t pixel) { PS_send((uint8_t) pixel); PS_wait(); }
+};
+
+struct PSFormatRGB565 {
+    static const uint8_t bytes = 2;
+    static inline uint16_t fromColor8(uint8_t color) { return PS_color16(color); }
+    static inline uint16_t fromColor16(uint16_t color) { return color; }
+    static inline uint16_t toColor16(uint16_t pixel) { return pixel; }
+    static inline uint16_t load(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+    static inline void store(uint8_t *p, uint16_t pixel) { p[0] = pixel >> 8; p[1] = pixel; }
+    static inline void fill(uint8_t *p, uint16_t pixel, uint16_t count) {
+        while (count--) {
+            *p++ = pixel >> 8;
+            *p++ = pixel;
+        }
+    }
+    static inline void send(uint16_t pixel) { PS_send(pixel >> 8); PS_wait(); PS_send((uint8_t) pixel); PS_wait(); }
+};
+
+// pixel conversion between two formats, nothing to do if they are the same
+template <class Source, class Target> struct PSConvert {
+    static inline uint16_t pixel(uint16_t pixel) { return Target::fromColor16(Source::toColor16(pixel)); }
+};
+
+template <class Format> struct PSConvert<Format, Format> {
+    static inline uint16_t pixel(uint16_t pixel) { return pixel; }
+};
+
+// 8 bit pixels to 16 bit, high byte first. src may be the second half of dst
+inline void PS_expandPixels(uint8_t *dst, const uint8_t *src, uint16_t count, const uint16_t *table) {
+    while (count--) {
+        uint16_t pixel = table[*src++];
+        *dst++ = pixel >> 8;
+        *dst++ = pixel;
+    }
+}
+
+// sends count pixels of the same color to the display
+template <class Format> inline void PS_sendPixels(uint16_t pixel, uint16_t count) {
+    while (count--)
+        Format::send(pixel);
+}
+
+#endif
@@ -1,6 +1,6 @@
 /*
 PS_PauseMenuImages.h
-Last modified 02 Dec 2018
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -35,17 +35,17 @@ static const uint8_t PROGMEM batteryImage2LData[12*7] = {0x0, 0x0, 0x0, 0x0, 0x0
 static const uint8_t PROGMEM batteryImage3LData[12*7] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x2, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2};
 
 static PSImage PROGMEM batteryImages[4] = {
-    {12, 7, BitDepth8, batteryImage0Data},
-    {12, 7, BitDepth8, batteryImage1Data},
-    {12, 7, BitDepth8, batteryImage2Data},
-    {12, 7, BitDepth8, batteryImage3Data},
+    {12, 7, BitDepth8, batteryImage0Data, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage1Data, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage2Data, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage3Data, EncodingRaw, NULL},
 };
 
 static PSImage PROGMEM batteryLoadingImages[4] = {
-    {12, 7, BitDepth8, batteryImage0LData},
-    {12, 7, BitDepth8, batteryImage1LData},
-    {12, 7, BitDepth8, batteryImage2LData},
-    {12, 7, BitDepth8, batteryImage3LData},
+    {12, 7, BitDepth8, batteryImage0LData, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage1LData, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage2LData, EncodingRaw, NULL},
+    {12, 7, BitDepth8, batteryImage3LData, EncodingRaw, NULL},
 };
 
 #endif
\ No newline at end of file
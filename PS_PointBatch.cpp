@@ -0,0 +1,156 @@
+/*
+PS_PointBatch.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "PocketStar.h"
+#include "PS_PointBatch.h"
+#include "PS_Internal.h"
+
+// sort order: rows from top to bottom, columns from left to right
+static boolean PS_pointBefore(const PSPoint *p, const PSPoint *q) {
+    if (p->y != q->y)
+        return p->y < q->y;
+    return p->x < q->x;
+}
+
+// binary insertion sort. it is stable, points on the same pixel stay in the order they were drawn
+static void PS_sortPoints(PSPoint *points, uint16_t count) {
+    for (uint16_t i = 1; i < count; i++) {
+        PSPoint point = points[i];
+        // the point goes behind every point which is not after it
+        uint16_t low = 0;
+        uint16_t high = i;
+        while (low < high) {
+            uint16_t middle = (low + high) / 2;
+            if (PS_pointBefore(&point, &points[middle]))
+                high = middle;
+            else
+                low = middle + 1;
+        }
+        if (low == i)
+            continue;
+        memmove(points + low + 1, points + low, (i - low) * sizeof(PSPoint));
+        points[low] = point;
+    }
+}
+
+PSPointBatch::PSPointBatch(PSPoint *_points, uint16_t _capacity) {
+    points = _points;
+    capacity = _capacity;
+    count = 0;
+}
+
+void PSPointBatch::clear(void) {
+    count = 0;
+}
+
+uint16_t PSPointBatch::size(void) {
+    return count;
+}
+
+boolean PSPointBatch::isFull(void) {
+    return count >= capacity;
+}
+
+void PSPointBatch::drawPixel(uint8_t x, uint8_t y, uint16_t color) {
+    if (x > PocketStar::xMax || y > PocketStar::yMax)
+        return;
+    if (isFull())
+        submit();
+    if (capacity == 0) {
+        pocketstar.drawPixel(x, y, color);
+        return;
+    }
+    points[count].x = x;
+    points[count].y = y;
+    points[count].color = color;
+    count++;
+}
+
+// end of the run of neighbouring points starting at first
+uint16_t PSPointBatch::span(uint16_t first) {
+    uint16_t end = first + 1;
+    while (end < count && points[end].y == points[first].y && points[end].x == points[end - 1].x + 1)
+        end++;
+    return end;
+}
+
+void PSPointBatch::submit(void) {
+    if (count == 0)
+        return;
+    if (pocketstar.shadow) {
+        for (uint16_t i = 0; i < count; i++)
+            pocketstar.drawPixel(points[i].x, points[i].y, points[i].color);
+        count = 0;
+        return;
+    }
+    
+    PS_sortPoints(points, count);
+    // keep one point per pixel, the one drawn last
+    uint16_t n = 1;
+    for (uint16_t i = 1; i < count; i++) {
+        if (points[i].x != points[n - 1].x || points[i].y != points[n - 1].y)
+            n++;
+        points[n - 1] = points[i];
+    }
+    count = n;
+    
+    pocketstar.beginBatch();
+    uint16_t i = 0;
+    while (i < count) {
+        uint16_t next = span(i);
+        uint8_t x1 = points[i].x;
+        uint8_t x2 = points[next - 1].x;
+        uint8_t y = points[i].y;
+        uint8_t rows = 1;
+        // spans with the same columns on the following rows, a window must not cross the wrap row
+        while (next < count && points[next].y == y + rows && points[next].x == x1 && y + rows != pocketstar.wrapRow()) {
+            uint16_t end = span(next);
+            if (points[end - 1].x != x2)
+                break;
+            next = end;
+            rows++;
+        }
+        
+        pocketstar.setX(x1, x2);
+        pocketstar.setY(y, y + rows - 1);
+        pocketstar.startTransfer();
+        if (pocketstar.bitDepth16)
+            send<PSFormatRGB565>(i, next);
+        else if (pocketstar.expansion) {
+            for (uint16_t k = i; k < next; k++)
+                PSFormatRGB565::send(pocketstar.expansion[(uint8_t) points[k].color]);
+        } else
+            send<PSFormatRGB332>(i, next);
+        i = next;
+        pocketstar.sending = true;
+        pocketstar.endTransfer();
+        pocketstar.windowDone();
+    }
+    pocketstar.endBatch();
+    count = 0;
+}
+
+template <class Format> void PSPointBatch::send(uint16_t first, uint16_t end) {
+    for (uint16_t i = first; i < end; i++)
+        Format::send(points[i].color);
+}
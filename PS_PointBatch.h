@@ -0,0 +1,60 @@
+/*
+PS_PointBatch.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef PS_PointBatch_h
+#define PS_PointBatch_h
+
+#include <Arduino.h>
+
+// one collected pixel, the color is in the bit depth of the display
+typedef struct {
+    uint8_t         x, y;
+    uint16_t        color;
+} PSPoint;
+
+// Collects single pixels and sends them together: the points are sorted by row, neighbours are merged
+// into spans and each span gets a single window. Spans with the same columns on consecutive rows share
+// one window, too. The point array is provided by the caller.
+class PSPointBatch {
+  public:
+    PSPointBatch(PSPoint *points, uint16_t capacity);
+
+    void clear(void);
+    uint16_t size(void);
+    boolean isFull(void);
+
+    // same as PocketStar::drawPixel(), a full batch is submitted first.
+    // if a pixel is drawn twice before submit(), the color drawn last is kept
+    void drawPixel(uint8_t x, uint8_t y, uint16_t color);
+    // sends all points and clears the batch
+    void submit(void);
+
+  private:
+    PSPoint *points;
+    uint16_t capacity, count;
+
+    uint16_t span(uint16_t first);
+    template <class Format> void send(uint16_t first, uint16_t end);
+};
+
+#endif
@@ -0,0 +1,152 @@
+/*
+PS_Shapes.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "PS_Shapes.h"
+#include "PS_Internal.h"
+
+// left and right end of each row of a polygon
+typedef struct {
+    int16_t         top;
+    int16_t         left[64], right[64];
+} PSRowBounds;
+
+static void PS_rowSpans(int16_t x, int16_t y, int16_t halfWidth, int16_t inner, uint16_t color,
+                        int16_t top, int16_t bottom, PSSpanFunction span, void *target) {
+    if (y < top || y > bottom)
+        return;
+    if (inner == 0)
+        span(target, x - halfWidth, x + halfWidth, y, color);
+    else {
+        span(target, x - halfWidth, x - inner, y, color);
+        span(target, x + inner, x + halfWidth, y, color);
+    }
+}
+
+static void PS_boundsSpan(void *target, int16_t x1, int16_t x2, int16_t y, uint16_t) {
+    PSRowBounds *bounds = (PSRowBounds *) target;
+    uint8_t row = y - bounds->top;
+    if (x1 < bounds->left[row])
+        bounds->left[row] = x1;
+    if (x2 > bounds->right[row])
+        bounds->right[row] = x2;
+}
+
+void PS_ellipseSpans(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color,
+                     int16_t top, int16_t bottom, PSSpanFunction span, void *target) {
+    if (radiusX < 0 || radiusY < 0 || y + radiusY < top || y - radiusY > bottom)
+        return;
+    // larger radii are drawn as 127, so the terms below fit 32 bit
+    radiusX = PS_min(radiusX, 127);
+    radiusY = PS_min(radiusY, 127);
+    // a pixel is inside if its center is inside the ellipse with half a pixel added to both radii:
+    // 4 * (dx * dx * b + dy * dy * a) <= a * b. a is an odd square (4 k + 1), a * b / 4 rounded down is k * b + b / 4
+    int32_t a = (2 * radiusX + 1) * (2 * radiusX + 1);
+    int32_t b = (2 * radiusY + 1) * (2 * radiusY + 1);
+    int32_t limit = (a >> 2) * b + (b >> 2);
+    int16_t halfWidth = radiusX;
+
+    for (int16_t dy = 0; dy <= radiusY; dy++) {
+        // half width of the next row, the outline covers the columns between both
+        int16_t next = -1;
+        if (dy < radiusY) {
+            next = halfWidth;
+            while (next > 0 && next * next * b + (dy + 1) * (dy + 1) * a > limit)
+                next--;
+        }
+        int16_t inner = fill ? 0 : PS_min(next + 1, halfWidth);
+        PS_rowSpans(x, y - dy, halfWidth, inner, color, top, bottom, span, target);
+        if (dy > 0)
+            PS_rowSpans(x, y + dy, halfWidth, inner, color, top, bottom, span, target);
+        halfWidth = next;
+    }
+}
+
+void PS_lineSpans(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color,
+                  int16_t top, int16_t bottom, PSSpanFunction span, void *target) {
+    if ((y1 < top && y2 < top) || (y1 > bottom && y2 > bottom))
+        return;
+    int16_t dx = abs(x2 - x1);
+    int16_t dy = -abs(y2 - y1);
+    int8_t sx = x1 < x2 ? 1 : -1;
+    int8_t sy = y1 < y2 ? 1 : -1;
+    int16_t error = dx + dy;
+    int16_t start = x1;
+
+    while (true) {
+        int16_t x = x1;
+        int16_t y = y1;
+        boolean last = x1 == x2 && y1 == y2;
+        if (!last) {
+            int16_t e2 = error << 1;
+            if (e2 >= dy) {
+                error += dy;
+                x1 += sx;
+            }
+            if (e2 <= dx) {
+                error += dx;
+                y1 += sy;
+            }
+        }
+        // a run ends when the line changes the row
+        if (last || y1 != y) {
+            if (y >= top && y <= bottom)
+                span(target, PS_min(start, x), PS_max(start, x), y, color);
+            start = x1;
+        }
+        if (last)
+            break;
+    }
+}
+
+void PS_polygonSpans(const PSVertex *vertices, uint8_t numVertices, uint16_t color,
+                     int16_t top, int16_t bottom, PSSpanFunction span, void *target) {
+    if (numVertices == 0)
+        return;
+    int16_t minY = vertices[0].y;
+    int16_t maxY = vertices[0].y;
+    for (uint8_t i = 1; i < numVertices; i++) {
+        minY = PS_min(minY, vertices[i].y);
+        maxY = PS_max(maxY, vertices[i].y);
+    }
+    top = PS_max(top, minY);
+    bottom = PS_min(PS_min(bottom, maxY), top + 63);
+    if (top > bottom)
+        return;
+
+    // the edges are traced like lines, each row is filled from the leftmost to the rightmost edge pixel
+    PSRowBounds bounds;
+    bounds.top = top;
+    for (uint8_t row = 0; row <= bottom - top; row++) {
+        bounds.left[row] = 0x7FFF;
+        bounds.right[row] = -0x8000;
+    }
+    for (uint8_t i = 0; i < numVertices; i++) {
+        const PSVertex *a = &vertices[i];
+        const PSVertex *b = &vertices[i + 1 < numVertices ? i + 1 : 0];
+        PS_lineSpans(a->x, a->y, b->x, b->y, color, top, bottom, PS_boundsSpan, &bounds);
+    }
+    for (uint8_t row = 0; row <= bottom - top; row++) {
+        if (bounds.left[row] <= bounds.right[row])
+            span(target, bounds.left[row], bounds.right[row], top + row, color);
+    }
+}
@@ -0,0 +1,47 @@
+/*
+PS_Shapes.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef PS_Shapes_h
+#define PS_Shapes_h
+
+#include <Arduino.h>
+
+// corner of a triangle or polygon
+typedef struct {
+    int16_t         x, y;
+} PSVertex;
+
+// Scanline rasterizer shared by PocketStar and PSCanvas. Shapes are cut into horizontal spans from x1 to x2
+// (x1 <= x2) which are passed to the span function. Rows outside top to bottom are skipped, columns are not clipped.
+typedef void (*PSSpanFunction)(void *target, int16_t x1, int16_t x2, int16_t y, uint16_t color);
+
+void PS_ellipseSpans(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color,
+                     int16_t top, int16_t bottom, PSSpanFunction span, void *target);
+// the runs of a line, the same pixels as PSCanvas::drawLine()
+void PS_lineSpans(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color,
+                  int16_t top, int16_t bottom, PSSpanFunction span, void *target);
+// filled convex polygon, the edges are included. at most 64 rows are drawn
+void PS_polygonSpans(const PSVertex *vertices, uint8_t numVertices, uint16_t color,
+                     int16_t top, int16_t bottom, PSSpanFunction span, void *target);
+
+#endif
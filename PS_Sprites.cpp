@@ -0,0 +1,74 @@
+/*
+PS_Sprites.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PocketStar.h"
+#include "PS_Sprites.h"
+
+// writes the spans if buffer is not NULL, returns their size either way. the size is counted in 32 bit,
+// so spans too large for the 16 bit row positions are noticed
+static uint32_t PS_spans(const PSImage *image, uint8_t *buffer, uint8_t transparent) {
+    uint32_t size = 2 * image->height;
+    for (uint8_t y = 0; y < image->height; y++) {
+        const uint8_t *row = image->data + y * image->width;
+        if (buffer) {
+            buffer[2 * y] = size;
+            buffer[2 * y + 1] = size >> 8;
+        }
+        uint32_t count = size++;
+        uint8_t numSpans = 0;
+        for (uint8_t x = 0; x < image->width; ) {
+            if (row[x] == transparent) {
+                x++;
+                continue;
+            }
+            uint8_t length = 1;
+            while (x + length < image->width && row[x + length] != transparent)
+                length++;
+            if (buffer) {
+                buffer[size] = x;
+                buffer[size + 1] = length;
+                memcpy(buffer + size + 2, row + x, length);
+            }
+            size += 2 + length;
+            numSpans++;
+            x += length;
+        }
+        if (buffer)
+            buffer[count] = numSpans;
+    }
+    return size;
+}
+
+uint16_t PS_spanSize(const PSImage *image, uint8_t transparent) {
+    if (image->bitDepth != BitDepth8 || image->encoding != EncodingRaw)
+        return 0;
+    uint32_t size = PS_spans(image, NULL, transparent);
+    return size > 0xFFFF ? 0 : size;
+}
+
+PSImage PS_encodeSpans(const PSImage *image, uint8_t *buffer, uint8_t transparent) {
+    PSImage spans = {image->width, image->height, BitDepth8, buffer, EncodingSpans, NULL};
+    if (PS_spanSize(image, transparent) == 0)
+        return *image;
+    PS_spans(image, buffer, transparent);
+    return spans;
+}
@@ -1,6 +1,6 @@
 /*
 PS_Sprites.h
-Last modified 22 Jul 2018
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -27,6 +27,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 const uint8_t ALPHA = 0xFD;
 
+// PocketStar::drawSprites() keeps a few bytes per sprite on the stack, the sprites after the first PS_MAX_SPRITES are not drawn
+#define PS_MAX_SPRITES 64
+
 typedef struct {
   public:
     PSImage         *image;
@@ -34,6 +37,57 @@ typedef struct {
     int16_t         y;
     boolean         enabled;
     boolean         mirrorFlag;
+    const PSAtlas   *atlas;     // if set, the sprite shows the given frame of the atlas instead of the image
+    uint8_t         frame;
 } PSSprite;
 
+// image, size, first pixel and row length of what a sprite shows
+inline const PSImage *PS_spriteImage(const PSSprite *sprite) {
+    return sprite->atlas ? sprite->atlas->image : sprite->image;
+}
+
+inline uint8_t PS_spriteWidth(const PSSprite *sprite) {
+    return sprite->atlas ? sprite->atlas->frames[sprite->frame].width : sprite->image->width;
+}
+
+inline uint8_t PS_spriteHeight(const PSSprite *sprite) {
+    return sprite->atlas ? sprite->atlas->frames[sprite->frame].height : sprite->image->height;
+}
+
+inline uint8_t PS_spriteStride(const PSSprite *sprite) {
+    return PS_spriteImage(sprite)->width;
+}
+
+// position of the frame in the image
+inline uint8_t PS_spriteLeft(const PSSprite *sprite) {
+    return sprite->atlas ? sprite->atlas->frames[sprite->frame].x : 0;
+}
+
+inline uint8_t PS_spriteTop(const PSSprite *sprite) {
+    return sprite->atlas ? sprite->atlas->frames[sprite->frame].y : 0;
+}
+
+// number of the first pixel in the image
+inline uint16_t PS_spriteOffset(const PSSprite *sprite) {
+    return PS_spriteTop(sprite) * PS_spriteStride(sprite) + PS_spriteLeft(sprite);
+}
+
+inline const uint8_t *PS_spriteData(const PSSprite *sprite) {
+    return PS_spriteImage(sprite)->data + PS_spriteOffset(sprite);
+}
+
+// EncodingSpans: sprites which skip their transparent pixels without testing them. The image data starts with
+// the position of each row (2 bytes each, low byte first, counted from the start of the data). A row is the
+// number of opaque spans followed by the spans: column, length and the pixels. Any color can be opaque.
+// The spans are made from an 8 bit image when the sketch starts, extra/encode_images.py --sprites does it beforehand.
+// drawImage() draws them as well, the gaps are transparent there, too.
+// the spans of an image can take up to 65535 bytes, PS_spanSize() is 0 for larger ones and for images which are not raw 8 bit
+uint16_t PS_spanSize(const PSImage *image, uint8_t transparent = ALPHA);
+// buffer has to hold PS_spanSize() bytes, the returned image uses it. unsupported images are returned unchanged
+PSImage PS_encodeSpans(const PSImage *image, uint8_t *buffer, uint8_t transparent = ALPHA);
+
+inline const uint8_t *PS_spanRow(const PSImage *image, uint8_t row) {
+    return image->data + (image->data[2 * row] | (image->data[2 * row + 1] << 8));
+}
+
 #endif
\ No newline at end of file
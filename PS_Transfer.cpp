@@ -0,0 +1,258 @@
+/*
+PS_Transfer.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PS_Transfer.h"
+
+#ifndef PS_HOST
+
+static PSTransfer *_transfer = NULL;
+static DmacDescriptor *_descriptor = NULL;
+static DmacDescriptor _descriptors[PS_TRANSFER_CHANNEL + 1] __attribute__((aligned(16)));
+static DmacDescriptor _writeback[PS_TRANSFER_CHANNEL + 1] __attribute__((aligned(16)));
+// a repeated pattern: the loop descriptor links to itself until the tail is due, the tail ends the transfer
+static DmacDescriptor _loop __attribute__((aligned(16)));
+static DmacDescriptor _tail __attribute__((aligned(16)));
+
+PSTransfer::PSTransfer() {
+    running = false;
+    pending = false;
+    callback = NULL;
+    remaining = 0;
+}
+
+void PSTransfer::begin(void) {
+    _transfer = this;
+
+    PM->AHBMASK.reg |= PM_AHBMASK_DMAC;
+    PM->APBBMASK.reg |= PM_APBBMASK_DMAC;
+
+    // share the descriptor memory if someone else already set up the DMAC
+    if (!DMAC->CTRL.bit.DMAENABLE) {
+        DMAC->CTRL.reg = DMAC_CTRL_SWRST;
+        while (DMAC->CTRL.bit.SWRST);
+        DMAC->BASEADDR.reg = (uint32_t) _descriptors;
+        DMAC->WRBADDR.reg = (uint32_t) _writeback;
+        DMAC->CTRL.reg = DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF);
+    }
+    _descriptor = ((DmacDescriptor *) DMAC->BASEADDR.reg) + PS_TRANSFER_CHANNEL;
+
+    DMAC->CHID.reg = DMAC_CHID_ID(PS_TRANSFER_CHANNEL);
+    DMAC->CHCTRLA.reg &= ~DMAC_CHCTRLA_ENABLE;
+    DMAC->CHCTRLA.reg = DMAC_CHCTRLA_SWRST;
+    DMAC->SWTRIGCTRL.reg &= ~(1 << PS_TRANSFER_CHANNEL);
+    DMAC->CHCTRLB.reg = DMAC_CHCTRLB_LVL(0) | DMAC_CHCTRLB_TRIGSRC(SERCOM4_DMAC_ID_TX) | DMAC_CHCTRLB_TRIGACT_BEAT;
+    DMAC->CHINTENSET.reg = DMAC_CHINTENSET_TCMPL | DMAC_CHINTENSET_TERR;
+
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+void PSTransfer::start(const uint8_t *buffer, uint16_t count) {
+    while (running);
+    if (count == 0)
+        return;
+
+    running = true;
+    pending = true;
+
+    // with SRCINC the source address points behind the last byte
+    _descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | DMAC_BTCTRL_SRCINC | DMAC_BTCTRL_BLOCKACT_NOACT;
+    _descriptor->BTCNT.reg = count;
+    _descriptor->SRCADDR.reg = (uint32_t) (buffer + count);
+    _descriptor->DSTADDR.reg = (uint32_t) &SERCOM4->SPI.DATA.reg;
+    _descriptor->DESCADDR.reg = 0;
+
+    NVIC_DisableIRQ(DMAC_IRQn);
+    DMAC->CHID.reg = DMAC_CHID_ID(PS_TRANSFER_CHANNEL);
+    DMAC->CHCTRLA.reg |= DMAC_CHCTRLA_ENABLE;
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+// one block of a repeated pattern. a single byte is read from a fixed address, longer patterns from the start each time
+static void PS_patternBlock(DmacDescriptor *descriptor, const uint8_t *pattern, uint16_t length, uint16_t count, DmacDescriptor *next, boolean interrupt) {
+    uint16_t flags = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE;
+    if (length > 1)
+        flags |= DMAC_BTCTRL_SRCINC;
+    flags |= interrupt ? DMAC_BTCTRL_BLOCKACT_INT : DMAC_BTCTRL_BLOCKACT_NOACT;
+    descriptor->BTCTRL.reg = flags;
+    descriptor->BTCNT.reg = count;
+    descriptor->SRCADDR.reg = (uint32_t) (length > 1 ? pattern + count : pattern);
+    descriptor->DSTADDR.reg = (uint32_t) &SERCOM4->SPI.DATA.reg;
+    descriptor->DESCADDR.reg = (uint32_t) next;
+}
+
+// the DMAC has no repeat count: whole blocks run through the self linked loop descriptor without being
+// armed again, the block interrupts only count them. the DMAC fetches the next descriptor as soon as a
+// block is through, so the loop is pointed at the tail one block ahead, while the second to last block runs
+void PSTransfer::repeat(const uint8_t *pattern, uint16_t length, uint32_t count) {
+    while (running);
+    if (count == 0 || length == 0)
+        return;
+
+    uint16_t block = length == 1 ? 0xFFFF : length;
+    // the tail is 1 to block bytes long, the blocks before it are whole
+    uint32_t blocks = (count - 1) / block;
+    uint16_t tail = count - blocks * block;
+
+    running = true;
+    pending = true;
+    if (blocks == 0) {
+        PS_patternBlock(_descriptor, pattern, length, tail, NULL, false);
+    } else {
+        PS_patternBlock(&_tail, pattern, length, tail, NULL, false);
+        // with up to two blocks the links are known in advance
+        remaining = blocks > 2 ? blocks - 2 : 0;
+        PS_patternBlock(&_loop, pattern, length, block, blocks > 2 ? &_loop : &_tail, remaining > 0);
+        PS_patternBlock(_descriptor, pattern, length, block, blocks > 1 ? &_loop : &_tail, remaining > 0);
+    }
+
+    NVIC_DisableIRQ(DMAC_IRQn);
+    DMAC->CHID.reg = DMAC_CHID_ID(PS_TRANSFER_CHANNEL);
+    DMAC->CHCTRLA.reg |= DMAC_CHCTRLA_ENABLE;
+    NVIC_EnableIRQ(DMAC_IRQn);
+}
+
+bool PSTransfer::busy(void) {
+    return running;
+}
+
+void PSTransfer::wait(void) {
+    while (running);
+    if (!pending)
+        return;
+    pending = false;
+
+    // the DMAC is done once the last byte is in the data register, it still has to be shifted out
+    while (SERCOM4->SPI.INTFLAG.bit.TXC == 0);
+    // drop the bytes received meanwhile, SPI.transfer() would read them otherwise
+    while (SERCOM4->SPI.INTFLAG.bit.RXC)
+        SERCOM4->SPI.DATA.reg;
+    SERCOM4->SPI.STATUS.bit.BUFOVF = 1;
+}
+
+void PSTransfer::setCallback(PSTransferCallback _callback) {
+    callback = _callback;
+}
+
+void PSTransfer::_complete(void) {
+    running = false;
+    if (callback)
+        callback();
+}
+
+// a block of a repeated pattern is through and the channel goes on by itself
+void PSTransfer::_block(void) {
+    if (remaining > 0 && --remaining == 0) {
+        _loop.DESCADDR.reg = (uint32_t) &_tail;
+        _loop.BTCTRL.reg &= ~DMAC_BTCTRL_BLOCKACT_Msk;
+    }
+}
+
+extern "C" void DMAC_Handler(void) {
+    uint8_t channel = DMAC->CHID.reg;
+    DMAC->CHID.reg = DMAC_CHID_ID(PS_TRANSFER_CHANNEL);
+    uint8_t flags = DMAC->CHINTFLAG.reg;
+    DMAC->CHINTFLAG.reg = flags;
+    // the channel is switched off when the last block is through
+    boolean enabled = DMAC->CHCTRLA.bit.ENABLE;
+    DMAC->CHID.reg = channel;
+
+    if (!_transfer)
+        return;
+    if ((flags & DMAC_CHINTFLAG_TCMPL) && enabled && !(flags & DMAC_CHINTFLAG_TERR))
+        _transfer->_block();
+    else if (flags & (DMAC_CHINTFLAG_TCMPL | DMAC_CHINTFLAG_TERR))
+        _transfer->_complete();
+}
+
+#else
+
+// host build: every transfer completes immediately into the sink
+
+PSTransferSink PSTransfer::sink = NULL;
+bool PSTransfer::commandMode = false;
+
+PSTransfer::PSTransfer() {
+    running = false;
+    pending = false;
+    callback = NULL;
+    remaining = 0;
+}
+
+void PSTransfer::begin(void) {
+}
+
+void PSTransfer::start(const uint8_t *buffer, uint16_t count) {
+    if (count == 0)
+        return;
+    running = true;
+    pending = true;
+    if (sink)
+        sink(buffer, count, commandMode);
+    _complete();
+}
+
+void PSTransfer::repeat(const uint8_t *pattern, uint16_t length, uint32_t count) {
+    if (count == 0 || length == 0)
+        return;
+    running = true;
+    pending = true;
+    while (count > 0) {
+        uint16_t part = count > length ? length : count;
+        if (sink)
+            sink(pattern, part, commandMode);
+        count -= part;
+    }
+    _complete();
+}
+
+bool PSTransfer::busy(void) {
+    return running;
+}
+
+void PSTransfer::wait(void) {
+    pending = false;
+}
+
+void PSTransfer::setCallback(PSTransferCallback _callback) {
+    callback = _callback;
+}
+
+void PSTransfer::setSink(PSTransferSink _sink) {
+    sink = _sink;
+}
+
+void PSTransfer::hostSend(uint8_t data) {
+    if (sink)
+        sink(&data, 1, commandMode);
+}
+
+void PSTransfer::hostCommandMode(bool command) {
+    commandMode = command;
+}
+
+void PSTransfer::_complete(void) {
+    running = false;
+    if (callback)
+        callback();
+}
+
+#endif
@@ -0,0 +1,78 @@
+/*
+PS_Transfer.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PS_Transfer_h
+#define PS_Transfer_h
+
+#include <Arduino.h>
+
+// DMA channel used for the display. Define it before including the library to move it.
+#ifndef PS_TRANSFER_CHANNEL
+#define PS_TRANSFER_CHANNEL 0
+#endif
+
+typedef void (*PSTransferCallback)(void);
+// receives the bytes sent to the display in a host build, command is true for command bytes
+typedef void (*PSTransferSink)(const uint8_t *data, uint16_t count, bool command);
+
+// Asynchronous byte stream to the display SPI (SERCOM4).
+// The bytes are moved by the DMAC, the source may be RAM or flash.
+// Built with PS_HOST defined (on a PC, see extra/host), every byte for the display, commands included,
+// is handed to a sink function instead, so the stream produced by the library can be checked off the board.
+class PSTransfer {
+  public:
+    PSTransfer();
+    void begin(void);
+
+    // starts sending count bytes and returns immediately, buffer has to stay valid until busy() is false
+    void start(const uint8_t *buffer, uint16_t count);
+    // sends count bytes by repeating the pattern. a single byte pattern is read from a fixed address,
+    // longer patterns are looped by a descriptor linked to itself, the pattern has to stay valid as well
+    void repeat(const uint8_t *pattern, uint16_t length, uint32_t count);
+    bool busy(void);
+    // waits until the last byte has left the SPI, afterwards CS and DC may be changed
+    void wait(void);
+    // called (from the interrupt) each time a transfer is complete
+    void setCallback(PSTransferCallback callback);
+
+#ifdef PS_HOST
+    static void setSink(PSTransferSink sink);
+    // single bytes and the data / command line, used by the library instead of the SPI registers
+    static void hostSend(uint8_t data);
+    static void hostCommandMode(bool command);
+#endif
+
+    void _complete(void);
+    void _block(void);
+
+  private:
+    volatile bool running;
+    bool pending;
+    volatile uint32_t remaining;    // blocks of a repeated pattern before the loop is pointed at the tail
+    PSTransferCallback callback;
+#ifdef PS_HOST
+    static PSTransferSink sink;
+    static bool commandMode;
+#endif
+};
+
+#endif
@@ -1,6 +1,6 @@
 /*
 PocketStar.cpp
-Last modified 07 Mar 2019
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -21,11 +21,43 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "PocketStar.h"
-
-#define PS_send(x) SERCOM4->SPI.DATA.bit.DATA = (x);
-#define PS_wait() while (SERCOM4->SPI.INTFLAG.bit.DRE == 0);
-#define PS_max(x, y) ((x) > (y)) ? (x) : (y)
-#define PS_min(x, y) ((x) < (y)) ? (x) : (y)
+#include "PS_Internal.h"
+
+// RGB 332 to RGB 565, the same as PS_color16()
+static const uint16_t PS_expansionTable[256] = {
+    0x0000, 0x000A, 0x0015, 0x001F, 0x0120, 0x012A, 0x0135, 0x013F,
+    0x0240, 0x024A, 0x0255, 0x025F, 0x0360, 0x036A, 0x0375, 0x037F,
+    0x0480, 0x048A, 0x0495, 0x049F, 0x05A0, 0x05AA, 0x05B5, 0x05BF,
+    0x06C0, 0x06CA, 0x06D5, 0x06DF, 0x07E0, 0x07EA, 0x07F5, 0x07FF,
+    0x2000, 0x200A, 0x2015, 0x201F, 0x2120, 0x212A, 0x2135, 0x213F,
+    0x2240, 0x224A, 0x2255, 0x225F, 0x2360, 0x236A, 0x2375, 0x237F,
+    0x2480, 0x248A, 0x2495, 0x249F, 0x25A0, 0x25AA, 0x25B5, 0x25BF,
+    0x26C0, 0x26CA, 0x26D5, 0x26DF, 0x27E0, 0x27EA, 0x27F5, 0x27FF,
+    0x4800, 0x480A, 0x4815, 0x481F, 0x4920, 0x492A, 0x4935, 0x493F,
+    0x4A40, 0x4A4A, 0x4A55, 0x4A5F, 0x4B60, 0x4B6A, 0x4B75, 0x4B7F,
+    0x4C80, 0x4C8A, 0x4C95, 0x4C9F, 0x4DA0, 0x4DAA, 0x4DB5, 0x4DBF,
+    0x4EC0, 0x4ECA, 0x4ED5, 0x4EDF, 0x4FE0, 0x4FEA, 0x4FF5, 0x4FFF,
+    0x6800, 0x680A, 0x6815, 0x681F, 0x6920, 0x692A, 0x6935, 0x693F,
+    0x6A40, 0x6A4A, 0x6A55, 0x6A5F, 0x6B60, 0x6B6A, 0x6B75, 0x6B7F,
+    0x6C80, 0x6C8A, 0x6C95, 0x6C9F, 0x6DA0, 0x6DAA, 0x6DB5, 0x6DBF,
+    0x6EC0, 0x6ECA, 0x6ED5, 0x6EDF, 0x6FE0, 0x6FEA, 0x6FF5, 0x6FFF,
+    0x9000, 0x900A, 0x9015, 0x901F, 0x9120, 0x912A, 0x9135, 0x913F,
+    0x9240, 0x924A, 0x9255, 0x925F, 0x9360, 0x936A, 0x9375, 0x937F,
+    0x9480, 0x948A, 0x9495, 0x949F, 0x95A0, 0x95AA, 0x95B5, 0x95BF,
+    0x96C0, 0x96CA, 0x96D5, 0x96DF, 0x97E0, 0x97EA, 0x97F5, 0x97FF,
+    0xB000, 0xB00A, 0xB015, 0xB01F, 0xB120, 0xB12A, 0xB135, 0xB13F,
+    0xB240, 0xB24A, 0xB255, 0xB25F, 0xB360, 0xB36A, 0xB375, 0xB37F,
+    0xB480, 0xB48A, 0xB495, 0xB49F, 0xB5A0, 0xB5AA, 0xB5B5, 0xB5BF,
+    0xB6C0, 0xB6CA, 0xB6D5, 0xB6DF, 0xB7E0, 0xB7EA, 0xB7F5, 0xB7FF,
+    0xD800, 0xD80A, 0xD815, 0xD81F, 0xD920, 0xD92A, 0xD935, 0xD93F,
+    0xDA40, 0xDA4A, 0xDA55, 0xDA5F, 0xDB60, 0xDB6A, 0xDB75, 0xDB7F,
+    0xDC80, 0xDC8A, 0xDC95, 0xDC9F, 0xDDA0, 0xDDAA, 0xDDB5, 0xDDBF,
+    0xDEC0, 0xDECA, 0xDED5, 0xDEDF, 0xDFE0, 0xDFEA, 0xDFF5, 0xDFFF,
+    0xF800, 0xF80A, 0xF815, 0xF81F, 0xF920, 0xF92A, 0xF935, 0xF93F,
+    0xFA40, 0xFA4A, 0xFA55, 0xFA5F, 0xFB60, 0xFB6A, 0xFB75, 0xFB7F,
+    0xFC80, 0xFC8A, 0xFC95, 0xFC9F, 0xFDA0, 0xFDAA, 0xFDB5, 0xFDBF,
+    0xFEC0, 0xFECA, 0xFED5, 0xFEDF, 0xFFE0, 0xFFEA, 0xFFF5, 0xFFFF
+};
 
 // init
 PocketStar::PocketStar() {
@@ -41,6 +73,20 @@ PocketStar::PocketStar() {
     bitDepth16 = false;
     mirror = false;
     colorModeBGR = false;
+    lineBufferIndex = 0;
+    expansion = NULL;
+    commandCount = 0;
+    batchDepth = 0;
+    sending = false;
+    shadow = NULL;
+    xshadow = NULL;
+    xexpansion = NULL;
+    scrollY = 0;
+    scrolling = false;
+    busyStart = 0;
+    busyTime = 0;
+    skippedCommands = 0;
+    invalidateCache();
     PocketStar_SPI = &SPI1;
 }
 
@@ -48,6 +94,7 @@ void PocketStar::begin(void) {
     PocketStar_SPI->begin();
     PocketStar_SPI->setDataMode(SPI_MODE0);
     PocketStar_SPI->setClockDivider(4);
+    transfer.begin();
 
     pinMode(PIN_SHDN, OUTPUT);
     pinMode(PIN_DC, OUTPUT);
@@ -55,8 +102,8 @@ void PocketStar::begin(void) {
     pinMode(PIN_RST, OUTPUT);
     
     digitalWrite(PIN_SHDN, LOW);
-    digitalWrite(PIN_DC, HIGH);
-    digitalWrite(PIN_CS, HIGH);
+    PS_dataMode();
+    PS_deselect();
     digitalWrite(PIN_RST, HIGH);
     
     pinMode(PIN_BUTTON_UP, INPUT_PULLUP);
@@ -88,13 +135,17 @@ void PocketStar::begin(void) {
     delay(5);
     digitalWrite(PIN_RST, HIGH);
     delay(10);
+    invalidateCache();
     
     const uint8_t init[32] = {0xAE, 0xA1, 0x00, 0xA2, 0x00, 0xA4, 0xA8, 0x3F, 0xAD, 0x8E, 0xB0, 0x0B, 0xB1, 0x31, 0xB3, 0xF0, 0x8A, 0x64, 0x8B, 0x78, 0x8C, 0x64, 0xBB, 0x3A, 0xBE, 0x3E, 0x81, 0x91, 0x82, 0x50, 0x83, 0x7D};
     off();
-    startCommandTransfer();
     for (uint8_t i = 0; i < 32; i++)
-        PocketStar_SPI->transfer(init[i]);
-    endTransfer();
+        command(init[i]);
+    commandDone();
+    // the init sequence ends with the contrast of the three colors, the reset left the remap at 0x40
+    for (uint8_t i = 0; i < 3; i++)
+        cachedContrast[i] = init[27 + 2 * i];
+    cachedRemap = 0x40;
     
     writeRemap();
     setBrightness(5);
@@ -104,31 +155,105 @@ void PocketStar::begin(void) {
 
 // general control
 void PocketStar::startTransfer(void) {
-    digitalWrite(PIN_DC, HIGH);
-    digitalWrite(PIN_CS, LOW);
+    sendCommands();
+    waitForCommand();
+    settle();
+    // writing pixels moves the address pointer
+    columnHome = false;
+    rowHome = false;
+    PS_dataMode();
+    PS_select();
+}
+
+void PocketStar::endTransfer(void) {
+    sendCommands();
+    settle();
+    if (!batchDepth)
+        PS_deselect();
 }
 
-void PocketStar::startCommandTransfer(void) {
-    digitalWrite(PIN_DC, LOW);
-    digitalWrite(PIN_CS, LOW);
+// commands sent between beginBatch() and endBatch() share one chip select, as do the pixels in between
+void PocketStar::beginBatch(void) {
+    batchDepth++;
 }
 
-void PocketStar::endTransfer(void) {
-    digitalWrite(PIN_CS, HIGH);
+void PocketStar::endBatch(void) {
+    if (batchDepth > 0)
+        batchDepth--;
+    commandDone();
+}
+
+// command bytes are collected and sent together once the command is complete
+void PocketStar::command(uint8_t c) {
+    if (commandCount == sizeof(commands))
+        sendCommands();
+    commands[commandCount++] = c;
+}
+
+void PocketStar::commandDone(void) {
+    if (batchDepth)
+        return;
+    sendCommands();
+    // an image may still be sent by DMA, the next transfer releases the display then
+    if (!transfer.busy())
+        PS_deselect();
+}
+
+void PocketStar::sendCommands(void) {
+    if (commandCount == 0)
+        return;
+    waitForCommand();
+    settle();
+    PS_commandMode();
+    PS_select();
+    PS_send(commands[0]);
+    for (uint8_t i = 1; i < commandCount; i++) {
+        PS_wait();
+        PS_send(commands[i]);
+    }
+    PS_wait();
+    sending = true;
+    commandCount = 0;
+}
+
+// chip select and data / command may only change once the last byte is out
+void PocketStar::settle(void) {
+    transfer.wait();
+    if (sending) {
+        PS_finish();
+        sending = false;
+    }
+}
+
+// the controller ignores everything sent while an accelerated graphics command is running.
+// instead of waiting right after the command, the next transfer waits for whatever is left of its time
+void PocketStar::setBusy(uint16_t time) {
+    // the command has to be on its way before its time starts
+    sendCommands();
+    busyStart = micros();
+    busyTime = time;
+    // don't rely on the address pointer after the controller drew something itself
+    columnHome = false;
+    rowHome = false;
+}
+
+void PocketStar::waitForCommand(void) {
+    if (busyTime == 0)
+        return;
+    while (micros() - busyStart < busyTime);
+    busyTime = 0;
 }
 
 void PocketStar::on(void) {
     digitalWrite(PIN_SHDN, HIGH);
-    startCommandTransfer();
     delayMicroseconds(10000);
-    PocketStar_SPI->transfer(COMMAND_DISPLAY_ON);
-    endTransfer();
+    command(COMMAND_DISPLAY_ON);
+    commandDone();
 }
 
 void PocketStar::off(void) {
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_DISPLAY_OFF);
-    endTransfer();
+    command(COMMAND_DISPLAY_OFF);
+    commandDone();
     digitalWrite(PIN_SHDN, LOW);
 }
 
@@ -142,6 +267,47 @@ void PocketStar::setBitDepth(uint8_t bitDepth) {
     writeRemap();
 }
 
+void PocketStar::setColorExpansion(boolean expand, const uint16_t *table) {
+    if (!expand)
+        expansion = NULL;
+    else
+        expansion = table ? table : PS_expansionTable;
+    writeRemap();
+}
+
+void PocketStar::makeExpansionTable(uint16_t *table, float gamma) {
+    for (uint16_t color = 0; color < 256; color++) {
+        uint8_t red = pow((color >> 5) / 7.0, gamma) * 31 + 0.5;
+        uint8_t green = pow(((color >> 2) & 0x7) / 7.0, gamma) * 63 + 0.5;
+        uint8_t blue = pow((color & 0x3) / 3.0, gamma) * 31 + 0.5;
+        table[color] = (red << 11) | (green << 5) | blue;
+    }
+}
+
+// bit depth of the display memory, with the color expansion it stays in 16 bit
+boolean PocketStar::panel16(void) {
+    return bitDepth16 || expansion;
+}
+
+// 8 bit color as it appears on the display
+uint16_t PocketStar::color16(uint8_t color) {
+    return expansion ? expansion[color] : PS_color16(color);
+}
+
+// color of the shapes, RGB 332 in 8 bit mode so the expansion is applied once when the pixels are sent
+uint16_t PocketStar::native(uint8_t color) {
+    return bitDepth16 ? color16(color) : color;
+}
+
+uint16_t PocketStar::native(uint16_t color) {
+    return bitDepth16 ? color : PS_color8(color);
+}
+
+// an 8 bit shadow keeps the 8 bit color and expands it when it is sent
+uint16_t PocketStar::shadowColor(uint8_t color) {
+    return shadow->bitDepth16 ? color16(color) : color;
+}
+
 void PocketStar::setColorMode(uint8_t colorMode) {
     colorModeBGR = colorMode;
     writeRemap();
@@ -151,158 +317,757 @@ void PocketStar::writeRemap() {
     uint8_t remap = (1 << 5);
     if (mirror)
         remap ^= (1 << 1);
-    if (bitDepth16)
+    if (panel16())
         remap ^= (1 << 6);
     if (colorModeBGR)
         remap ^= (1 << 2);
     
     remap ^= ((1 << 4) | (1 << 1));
     
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_SET_REMAP);
-    PocketStar_SPI->transfer(remap);
-    endTransfer();
+    if (remap == cachedRemap) {
+        skippedCommands++;
+        return;
+    }
+    cachedRemap = remap;
+    
+    command(COMMAND_SET_REMAP);
+    command(remap);
+    commandDone();
 }
 
 void PocketStar::setBrightness(uint8_t brightness) {
     if (brightness > 15)
         brightness = 15;    
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_MASTER_CURRENT);
-    PocketStar_SPI->transfer(brightness);
-    endTransfer();
+    if (brightness == cachedBrightness) {
+        skippedCommands++;
+        return;
+    }
+    cachedBrightness = brightness;
+    command(COMMAND_MASTER_CURRENT);
+    command(brightness);
+    commandDone();
+}
+
+void PocketStar::setContrast(uint8_t red, uint8_t green, uint8_t blue) {
+    const uint8_t commands[3] = {COMMAND_CONTRAST_A, COMMAND_CONTRAST_B, COMMAND_CONTRAST_C};
+    const uint8_t values[3] = {red, green, blue};
+    for (uint8_t i = 0; i < 3; i++) {
+        if (values[i] == cachedContrast[i]) {
+            skippedCommands++;
+            continue;
+        }
+        cachedContrast[i] = values[i];
+        command(commands[i]);
+        command(values[i]);
+        commandDone();
+    }
+}
+
+// controller state cache
+void PocketStar::invalidateCache(void) {
+    cachedRemap = 0xFF;
+    cachedFill = 0xFF;
+    cachedBrightness = 0xFF;
+    cachedColumnStart = 0xFF;
+    cachedColumnEnd = 0xFF;
+    cachedRowStart = 0xFF;
+    cachedRowEnd = 0xFF;
+    for (uint8_t i = 0; i < 3; i++)
+        cachedContrast[i] = 0xFFFF;
+    columnHome = false;
+    rowHome = false;
+}
+
+uint32_t PocketStar::getSkippedCommands(void) {
+    return skippedCommands;
+}
+
+// called after exactly filling the current window, the address pointer wrapped back to its start
+void PocketStar::windowDone(void) {
+    columnHome = true;
+    rowHome = true;
 }
 
 // accelerated graphics commands
 void PocketStar::clearWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
     if (x > xMax || y > yMax)
         return;
+    if (shadow) {
+        shadow->rect(x, y, width, height, true, 0);
+        return;
+    }
     uint8_t x2 = x + width - 1;
     uint8_t y2 = y + height - 1;
     if (x2 > xMax)
         x2 = xMax;
     if (y2 > yMax)
         y2 = yMax;
+    if (y < wrapRow() && y2 >= wrapRow()) {
+        clearWindow(x, y, width, wrapRow() - y);
+        clearWindow(x, wrapRow(), width, y2 + 1 - wrapRow());
+        return;
+    }
     
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_CLEAR_WINDOW);
-    PocketStar_SPI->transfer(x);
-    PocketStar_SPI->transfer(y);
-    PocketStar_SPI->transfer(x2);
-    PocketStar_SPI->transfer(y2);
-    endTransfer();
-    delayMicroseconds(400);
+    command(COMMAND_CLEAR_WINDOW);
+    command(x);
+    command((y + scrollY) & yMax);
+    command(x2);
+    command((y2 + scrollY) & yMax);
+    commandDone();
+    setBusy(PS_commandTime((x2 - x + 1) * (y2 - y + 1)));
 }
 
 void PocketStar::clearScreen() {
     clearWindow(0, 0, 96, 64);
 }
 
-void PocketStar::drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color) {
-    uint8_t red = (color >> 5) & 0x7;
-    uint8_t green = (color >> 2) & 0x7;
-    uint8_t blue = color & 0x3;
-    
-    red = red | (red << 3);
-    green = green | (green << 3);
-    blue = blue | (blue << 2) | (blue << 4);
+void PocketStar::dimWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+    if (x > xMax || y > yMax || width == 0 || height == 0)
+        return;
+    // the dimming happens on the display only, the canvas has to be sent before
+    flush();
+    uint8_t x2 = x + width - 1;
+    uint8_t y2 = y + height - 1;
+    if (x2 > xMax)
+        x2 = xMax;
+    if (y2 > yMax)
+        y2 = yMax;
+    if (y < wrapRow() && y2 >= wrapRow()) {
+        dimWindow(x, y, width, wrapRow() - y);
+        dimWindow(x, wrapRow(), width, y2 + 1 - wrapRow());
+        return;
+    }
     
-    drawLine(x1, y1, x2, y2, red, green, blue);
+    command(COMMAND_DIM_WINDOW);
+    command(x);
+    command((y + scrollY) & yMax);
+    command(x2);
+    command((y2 + scrollY) & yMax);
+    commandDone();
+    // every pixel is read and written back
+    setBusy(PS_commandTime(2 * (x2 - x + 1) * (y2 - y + 1)));
 }
 
-void PocketStar::drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint16_t color) {
-    uint8_t red = (color >> 10) & 0x3E;
-    uint8_t green = (color >> 5) & 0x3F;
-    uint8_t blue = (color << 1) & 0x3E;
-    
-    drawLine(x1, y1, x2, y2, red, green, blue);
+// rounded a / b for b > 0
+static int32_t PS_roundDiv(int64_t a, int64_t b) {
+    a = 2 * a + b;
+    b *= 2;
+    return a >= 0 ? a / b : -((b - 1 - a) / b);
 }
 
-void PocketStar::drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t red, uint8_t green, uint8_t blue) {
-    if (x1 > xMax)
-        x1 = xMax;
-    if (y1 > yMax)
-        y1 = yMax;
-    if (x2 > xMax)
-        x2 = xMax;
-    if (y2 > yMax)
-        y2 = yMax;
+// Liang-Barsky clipping to the screen, the clipped end points stay on the original line.
+// the screen is extended by half a pixel, so lines touching a border pixel are kept.
+// returns false if nothing of the line is visible
+static boolean PS_clipLine(int16_t &x1, int16_t &y1, int16_t &x2, int16_t &y2) {
+    int32_t dx = x2 - x1;
+    int32_t dy = y2 - y1;
+    int32_t p[4] = {-2 * dx, 2 * dx, -2 * dy, 2 * dy};
+    int32_t q[4] = {2 * x1 + 1, 2 * PocketStar::xMax + 1 - 2 * x1, 2 * y1 + 1, 2 * PocketStar::yMax + 1 - 2 * y1};
+    // the visible part runs from t = enter / enterDiv to t = leave / leaveDiv
+    int32_t enter = 0, enterDiv = 1, leave = 1, leaveDiv = 1;
+
+    for (uint8_t i = 0; i < 4; i++) {
+        if (p[i] == 0) {
+            if (q[i] < 0)
+                return false;
+        } else if (p[i] < 0) {
+            if ((int64_t) -q[i] * enterDiv > (int64_t) enter * -p[i]) {
+                enter = -q[i];
+                enterDiv = -p[i];
+            }
+        } else if ((int64_t) q[i] * leaveDiv < (int64_t) leave * p[i]) {
+            leave = q[i];
+            leaveDiv = p[i];
+        }
+    }
+    if ((int64_t) enter * leaveDiv > (int64_t) leave * enterDiv)
+        return false;
+
+    int16_t x = x1, y = y1;
+    if (enter > 0) {
+        x1 = x + PS_roundDiv(dx * (int64_t) enter, enterDiv);
+        y1 = y + PS_roundDiv(dy * (int64_t) enter, enterDiv);
+    }
+    if (leave < leaveDiv) {
+        x2 = x + PS_roundDiv(dx * (int64_t) leave, leaveDiv);
+        y2 = y + PS_roundDiv(dy * (int64_t) leave, leaveDiv);
+    }
+    // a point on the extended border may round to the outside
+    x1 = PS_min(PS_max(x1, 0), PocketStar::xMax);
+    y1 = PS_min(PS_max(y1, 0), PocketStar::yMax);
+    x2 = PS_min(PS_max(x2, 0), PocketStar::xMax);
+    y2 = PS_min(PS_max(y2, 0), PocketStar::yMax);
+    return true;
+}
+
+void PocketStar::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color) {
+    if (shadow) {
+        shadow->line(x1, y1, x2, y2, shadowColor(color));
+        return;
+    }
+    drawLine(x1, y1, x2, y2, color16(color));
+}
+
+void PocketStar::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    drawLine(x1, y1, x2, y2, PS_red6(color), PS_green6(color), PS_blue6(color));
+}
+
+void PocketStar::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t red, uint8_t green, uint8_t blue) {
+    if (shadow) {
+        shadow->line(x1, y1, x2, y2, shadow->native(PS_rgbTo16(red, green, blue)));
+        return;
+    }
+    if (!PS_clipLine(x1, y1, x2, y2))
+        return;
+    if (y1 > y2) {
+        int16_t temp = x1; x1 = x2; x2 = temp;
+        temp = y1; y1 = y2; y2 = temp;
+    }
+    if (y1 < wrapRow() && y2 >= wrapRow()) {
+        // split where the line crosses the wrap of the display memory
+        int16_t dx = x2 - x1;
+        int16_t dy = y2 - y1;
+        int16_t xa, xb;
+        if (abs(dx) > dy) {
+            xa = x1 + dx * (2 * (wrapRow() - y1) - 1) / (2 * dy);
+            xb = xa + (dx > 0 ? 1 : -1);
+        } else {
+            xa = x1 + (2 * dx * (wrapRow() - 1 - y1) + dy) / (2 * dy);
+            xb = x1 + (2 * dx * (wrapRow() - y1) + dy) / (2 * dy);
+        }
+        drawLine(x1, y1, xa, wrapRow() - 1, red, green, blue);
+        drawLine(xb, wrapRow(), x2, y2, red, green, blue);
+        return;
+    }
     
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_DRAW_LINE);
-    PocketStar_SPI->transfer(x1);
-    PocketStar_SPI->transfer(y1);
-    PocketStar_SPI->transfer(x2);
-    PocketStar_SPI->transfer(y2);
-    PocketStar_SPI->transfer(red);
-    PocketStar_SPI->transfer(green);
-    PocketStar_SPI->transfer(blue);
-    endTransfer();
-    delayMicroseconds(100);
+    command(COMMAND_DRAW_LINE);
+    command(x1);
+    command((y1 + scrollY) & yMax);
+    command(x2);
+    command((y2 + scrollY) & yMax);
+    command(red);
+    command(green);
+    command(blue);
+    commandDone();
+    setBusy(PS_commandTime(PS_max(abs(x2 - x1), y2 - y1) + 1));
 }
 
 void PocketStar::drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint8_t color) {
-    uint8_t red = (color >> 5) & 0x7;
-    uint8_t green = (color >> 2) & 0x7;
-    uint8_t blue = color & 0x3;
-    
-    red = red | (red << 3);
-    green = green | (green << 3);
-    blue = blue | (blue << 2) | (blue << 4);
-    
-    drawRect(x, y, width, height, fill, red, green, blue);
+    if (shadow) {
+        if (x <= xMax && y <= yMax)
+            shadow->rect(x, y, width, height, fill, shadowColor(color));
+        return;
+    }
+    drawRect(x, y, width, height, fill, color16(color));
 }
 
 void PocketStar::drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint16_t color) {
-    uint8_t red = (color >> 10) & 0x3E;
-    uint8_t green = (color >> 5) & 0x3F;
-    uint8_t blue = (color << 1) & 0x3E;
-    
-    drawRect(x, y, width, height, fill, red, green, blue);
+    drawRect(x, y, width, height, fill, PS_red6(color), PS_green6(color), PS_blue6(color));
 }
 
 void PocketStar::drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint8_t red, uint8_t green, uint8_t blue) {
     if (x > xMax || y > yMax || width == 0 || height == 0)
         return;
+    if (shadow) {
+        shadow->rect(x, y, width, height, fill, shadow->native(PS_rgbTo16(red, green, blue)));
+        return;
+    }
     uint8_t x2 = x + width - 1;
     uint8_t y2 = y + height - 1;
     if (x2 > xMax)
         x2 = xMax;
     if (y2 > yMax)
         y2 = yMax;
+    if (y < wrapRow() && y2 >= wrapRow()) {
+        if (fill) {
+            drawRect(x, y, width, wrapRow() - y, true, red, green, blue);
+            drawRect(x, wrapRow(), width, y2 + 1 - wrapRow(), true, red, green, blue);
+        } else {
+            drawLine(x, y, x2, y, red, green, blue);
+            drawLine(x, y2, x2, y2, red, green, blue);
+            drawLine(x, y, x, y2, red, green, blue);
+            drawLine(x2, y, x2, y2, red, green, blue);
+        }
+        return;
+    }
     
     uint8_t fillx = 0;
     if (fill)
         fillx = 1;
     
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_SET_FILL);
-    PocketStar_SPI->transfer(fillx);
-    PocketStar_SPI->transfer(COMMAND_DRAW_RECTANGLE);
-    PocketStar_SPI->transfer(x);
-    PocketStar_SPI->transfer(y);
-    PocketStar_SPI->transfer(x2);
-    PocketStar_SPI->transfer(y2);
-    PocketStar_SPI->transfer(red);
-    PocketStar_SPI->transfer(green);
-    PocketStar_SPI->transfer(blue);
-    PocketStar_SPI->transfer(red);
-    PocketStar_SPI->transfer(green);
-    PocketStar_SPI->transfer(blue);
+    if (fillx != cachedFill) {
+        cachedFill = fillx;
+        command(COMMAND_SET_FILL);
+        command(fillx);
+    } else
+        skippedCommands++;
+    command(COMMAND_DRAW_RECTANGLE);
+    command(x);
+    command((y + scrollY) & yMax);
+    command(x2);
+    command((y2 + scrollY) & yMax);
+    command(red);
+    command(green);
+    command(blue);
+    command(red);
+    command(green);
+    command(blue);
+    commandDone();
+    // an outline only writes its border
+    uint16_t pixels = (x2 - x + 1) * (y2 - y + 1);
+    if (!fill)
+        pixels = 2 * (x2 - x + 1) + 2 * (y2 - y + 1);
+    setBusy(PS_commandTime(pixels));
+}
+
+// copies a window inside the display memory, without sending any pixels
+void PocketStar::copyWindow(uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height, uint8_t dstX, uint8_t dstY) {
+    if (srcX > xMax || srcY > yMax || dstX > xMax || dstY > yMax || width == 0 || height == 0)
+        return;
+    width = PS_min(width, xMax + 1 - PS_max(srcX, dstX));
+    height = PS_min(height, yMax + 1 - PS_max(srcY, dstY));
+    
+    if (shadow) {
+        // pending changes in the source have to be on the display before it is copied
+        flush();
+        shadow->copy(srcX, srcY, width, height, dstX, dstY, false);
+    }
+    
+    // the controller copies row by row from the top-left, overlapping copies down or to the right
+    // are split into strips which do not overlap their own destination
+    if (dstY > srcY && dstY - srcY < height) {
+        uint8_t step = dstY - srcY;
+        for (int16_t offset = height - step; offset > -step; offset -= step) {
+            uint8_t top = PS_max(offset, 0);
+            copy(srcX, srcY + top, width, offset + step - top, dstX, dstY + top);
+        }
+    } else if (dstY == srcY && dstX > srcX && dstX - srcX < width) {
+        uint8_t step = dstX - srcX;
+        for (int16_t offset = width - step; offset > -step; offset -= step) {
+            uint8_t left = PS_max(offset, 0);
+            copy(srcX + left, srcY, offset + step - left, height, dstX + left, dstY);
+        }
+    } else
+        copy(srcX, srcY, width, height, dstX, dstY);
+}
+
+void PocketStar::copy(uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height, uint8_t dstX, uint8_t dstY) {
+    // neither source nor destination may cross the wrap of the display memory, the upper part goes first
+    uint8_t part = height;
+    if (srcY < wrapRow() && srcY + part > wrapRow())
+        part = wrapRow() - srcY;
+    if (dstY < wrapRow() && dstY + part > wrapRow())
+        part = wrapRow() - dstY;
+    if (part < height) {
+        copy(srcX, srcY, width, part, dstX, dstY);
+        copy(srcX, srcY + part, width, height - part, dstX, dstY + part);
+        return;
+    }
+    
+    command(COMMAND_COPY);
+    command(srcX);
+    command((srcY + scrollY) & yMax);
+    command(srcX + width - 1);
+    command((srcY + height - 1 + scrollY) & yMax);
+    command(dstX);
+    command((dstY + scrollY) & yMax);
+    commandDone();
+    setBusy(PS_commandTime(2 * width * height));
+}
+
+// moves the content of a window, the uncovered part is cleared
+void PocketStar::scrollWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t dx, int8_t dy) {
+    if (abs(dx) >= width || abs(dy) >= height) {
+        clearWindow(x, y, width, height);
+        return;
+    }
+    
+    uint8_t w = width - abs(dx);
+    uint8_t h = height - abs(dy);
+    copyWindow(dx < 0 ? x - dx : x, dy < 0 ? y - dy : y, w, h, dx > 0 ? x + dx : x, dy > 0 ? y + dy : y);
+    
+    if (dx > 0)
+        clearWindow(x, y, dx, height);
+    else if (dx < 0)
+        clearWindow(x + w, y, -dx, height);
+    if (dy > 0)
+        clearWindow(x, y, width, dy);
+    else if (dy < 0)
+        clearWindow(x, y + h, width, -dy);
+}
+
+// fills a grid of columns * rows tiles with the tile drawn at (x, y), doubling the copied area each step
+// sizes and offsets are computed in 16 bit and clamped to the screen, tiles past its edge are dropped
+void PocketStar::repeatWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t columns, uint8_t rows) {
+    for (uint16_t done = 1; done < columns && x + (uint16_t) width * done <= xMax; done <<= 1) {
+        uint16_t count = PS_min(done, (uint16_t) (columns - done));
+        copyWindow(x, y, PS_min((uint16_t) width * count, xMax), height, x + width * done, y);
+    }
+    uint16_t rowWidth = PS_min((uint16_t) width * columns, xMax + 1);
+    for (uint16_t done = 1; done < rows && y + (uint16_t) height * done <= yMax; done <<= 1) {
+        uint16_t count = PS_min(done, (uint16_t) (rows - done));
+        copyWindow(x, y, rowWidth, PS_min((uint16_t) height * count, yMax), x, y + height * done);
+    }
+}
+
+// moves a text area up by one line and puts the cursor at the beginning of the new last line
+void PocketStar::scrollConsole(uint8_t x, uint8_t y, uint8_t width, uint8_t height) {
+    if (fontHeight == 0 || fontHeight >= height)
+        return;
+    uint8_t h = height - fontHeight;
+    copyWindow(x, y + fontHeight, width, h, x, y);
+    if (bitDepth16)
+        drawRect(x, y + h, width, fontHeight, true, fontColorBackground);
+    else
+        drawRect(x, y + h, width, fontHeight, true, (uint8_t) fontColorBackground);
+    setCursor(x, y + h);
+}
+
+// hardware scrolling
+void PocketStar::setScrollOrigin(uint8_t y) {
+    y &= yMax;
+    if (shadow) {
+        flush();
+        // the content moves on the screen, so it moves in a canvas covering all rows as well.
+        // the rows coming into a smaller canvas are not in it, it is sent again where it is
+        if (shadow->height == yMax + 1)
+            shadow->rotate(y - scrollY);
+        else
+            shadow->markDirty(shadow->originX, shadow->originY, shadow->width, shadow->height);
+    }
+    scrollY = y;
+    command(COMMAND_START_LINE);
+    command(scrollY);
+    commandDone();
+}
+
+uint8_t PocketStar::getScrollOrigin(void) {
+    return scrollY;
+}
+
+void PocketStar::startScroll(uint8_t dx, uint8_t dy, uint8_t firstRow, uint8_t numRows, uint8_t interval) {
+    if (firstRow > yMax)
+        return;
+    numRows = PS_min(numRows, yMax + 1 - firstRow);
+    if (scrolling)
+        stopScroll();
+    
+    command(COMMAND_SCROLL_SETUP);
+    command(dx % (xMax + 1));
+    command((firstRow + scrollY) & yMax);
+    command(numRows);
+    command(dy & yMax);
+    command(interval & 0x3);
+    command(COMMAND_SCROLL_START);
+    commandDone();
+    scrolling = true;
+}
+
+void PocketStar::stopScroll(void) {
+    if (!scrolling)
+        return;
+    // the controller leaves the start line wherever the scrolling stopped, put our origin back
+    command(COMMAND_SCROLL_STOP);
+    command(COMMAND_START_LINE);
+    command(scrollY);
+    commandDone();
+    scrolling = false;
+    
+    // the scrolled memory is not what the canvas says anymore
+    if (shadow)
+        shadow->markDirty(shadow->originX, shadow->originY, shadow->width, shadow->height);
+}
+
+boolean PocketStar::isScrolling(void) {
+    return scrolling;
+}
+
+// first screen row which is stored at the top of the display memory
+uint8_t PocketStar::wrapRow(void) {
+    return yMax + 1 - scrollY;
+}
+
+// sends rows of pixels, split into two windows if they cross the wrap of the display memory.
+// the last transfer is left running like in writeBufferAsync()
+void PocketStar::writeRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, uint8_t bytesPerPixel, const uint8_t *data, uint16_t stride) {
+    uint16_t rowBytes = width * bytesPerPixel;
+    boolean expand = bytesPerPixel == 1 && expansion;
+    beginBatch();
+    while (rows > 0) {
+        uint8_t part = rows;
+        if (y < wrapRow() && y + rows > wrapRow())
+            part = wrapRow() - y;
+        setX(x, x + width - 1);
+        setY(y, y + part - 1);
+        startTransfer();
+        if (stride == rowBytes)
+            stream(data, ((uint32_t) rowBytes) * part, expand);
+        else {
+            for (uint8_t r = 0; r < part; r++)
+                stream(data + r * stride, rowBytes, expand);
+        }
+        if (x + width - 1 <= xMax && y + part - 1 <= yMax && (expand || bytesPerPixel == (panel16() ? 2 : 1)))
+            windowDone();
+        data += ((uint32_t) stride) * part;
+        y += part;
+        rows -= part;
+    }
+    endBatch();
+}
+
+// images made of spans: only the opaque pixels are sent, a window for each span. the gaps keep what is on the display
+void PocketStar::spanRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, const PSImage *image, uint8_t srcX, uint8_t srcY) {
+    beginBatch();
+    for (uint8_t row = 0; row < rows; row++) {
+        const uint8_t *p = PS_spanRow(image, srcY + row);
+        uint8_t numSpans = *p++;
+        while (numSpans--) {
+            uint8_t column = p[0];
+            uint8_t length = p[1];
+            const uint8_t *pixels = p + 2;
+            p += 2 + length;
+            int16_t begin = PS_max(column, srcX);
+            int16_t end = PS_min(column + length, srcX + width);
+            if (begin < end)
+                writeRows(x + begin - srcX, y + row, end - begin, 1, 1, pixels + begin - column, end - begin);
+        }
+    }
+    endBatch();
+}
+
+// compressed and indexed images are decoded a row at a time into the line buffers while the previous row is sent.
+// rows covered by a single run are drawn as a rectangle by the controller if that is faster
+void PocketStar::decodeRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, const PSImage *image, uint8_t srcX, uint8_t srcY) {
+    PSImageDecoder decoder(image);
+    uint8_t bytesPerPixel = image->bitDepth == BitDepth16 ? 2 : 1;
+    // indexed images have no bit depth of their own, their colors are converted for a display in 16 bit mode, too
+    const uint16_t *table = expansion ? expansion : PS_expansionTable;
+    boolean expand = bytesPerPixel == 1 && (expansion || (bitDepth16 && PS_isIndexed(image)));
+    // the rectangle only gets the color of the pixels if the image has the bit depth of the drawing functions
+    boolean rects = (bytesPerPixel == 2) == bitDepth16;
+    boolean open = false;
+    
+    decoder.skip(srcY * image->width + srcX);
+    beginBatch();
+    for (uint8_t row = 0; row < rows; row++) {
+        uint32_t run = rects ? decoder.run() : 0;
+        if (run >= width) {
+            uint8_t covered = PS_min(1 + (run - width) / image->width, (uint32_t) (rows - row));
+            if (PS_rectFaster(((uint16_t) covered) * width, panel16() ? 2 : 1)) {
+                if (bitDepth16)
+                    drawRect(x, y + row, width, covered, true, decoder.runPixel());
+                else
+                    drawRect(x, y + row, width, covered, true, (uint8_t) decoder.runPixel());
+                row += covered - 1;
+                if (row + 1 < rows)
+                    decoder.skip(((uint32_t) covered) * image->width);
+                open = false;
+                continue;
+            }
+        }
+        
+        // one window down to the wrap of the display memory
+        if (!open || y + row == wrapRow()) {
+            setX(x, x + width - 1);
+            setY(y + row, y + rows - 1);
+            startTransfer();
+            open = true;
+        }
+        lineBufferIndex ^= 1;
+        uint8_t *buffer = lineBuffers[lineBufferIndex];
+        if (expand) {
+            decoder.read(buffer + 96, width);
+            PS_expandPixels(buffer, buffer + 96, width, table);
+            transfer.start(buffer, width << 1);
+        } else {
+            decoder.read(buffer, width);
+            transfer.start(buffer, width * bytesPerPixel);
+        }
+        if (row + 1 < rows)
+            decoder.skip(image->width - width);
+    }
+    endBatch();
+}
+
+// shapes
+void PocketStar::drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint8_t color) {
+    drawEllipse(x, y, radius, radius, fill, color);
+}
+
+void PocketStar::drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint16_t color) {
+    drawEllipse(x, y, radius, radius, fill, color);
+}
+
+void PocketStar::drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint8_t color) {
+    if (shadow)
+        shadow->ellipse(x, y, radiusX, radiusY, fill, shadowColor(color));
+    else
+        ellipse(x, y, radiusX, radiusY, fill, native(color));
+}
+
+void PocketStar::drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color) {
+    if (shadow)
+        shadow->ellipse(x, y, radiusX, radiusY, fill, shadow->native(color));
+    else
+        ellipse(x, y, radiusX, radiusY, fill, native(color));
+}
+
+void PocketStar::drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint8_t color) {
+    PSVertex vertices[3] = {{x1, y1}, {x2, y2}, {x3, y3}};
+    drawPolygon(vertices, 3, fill, color);
+}
+
+void PocketStar::drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint16_t color) {
+    PSVertex vertices[3] = {{x1, y1}, {x2, y2}, {x3, y3}};
+    drawPolygon(vertices, 3, fill, color);
+}
+
+void PocketStar::drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint8_t color) {
+    if (shadow)
+        shadow->polygon(vertices, numVertices, fill, shadowColor(color));
+    else
+        polygon(vertices, numVertices, fill, native(color));
+}
+
+void PocketStar::drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color) {
+    if (shadow)
+        shadow->polygon(vertices, numVertices, fill, shadow->native(color));
+    else
+        polygon(vertices, numVertices, fill, native(color));
+}
+
+// the color is native(), the shadow is handled by the callers
+void PocketStar::ellipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color) {
+    beginBatch();
+    PS_ellipseSpans(x, y, radiusX, radiusY, fill, color, 0, yMax, rasterSpan, this);
+    endBatch();
+}
+
+void PocketStar::polygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color) {
+    beginBatch();
+    if (fill)
+        PS_polygonSpans(vertices, numVertices, color, 0, yMax, rasterSpan, this);
+    else {
+        for (uint8_t i = 0; i < numVertices; i++) {
+            const PSVertex *a = &vertices[i];
+            const PSVertex *b = &vertices[i + 1 < numVertices ? i + 1 : 0];
+            if (bitDepth16)
+                drawLine(a->x, a->y, b->x, b->y, color);
+            else
+                drawLine(a->x, a->y, b->x, b->y, (uint8_t) color);
+        }
+    }
+    endBatch();
+}
+
+// one row of a shape, only clipped vertically
+void PocketStar::span(int16_t x1, int16_t x2, int16_t y, uint16_t color) {
+    x1 = PS_max(x1, 0);
+    x2 = PS_min(x2, xMax);
+    if (x1 > x2)
+        return;
+    uint8_t width = x2 - x1 + 1;
+    if (PS_rectFaster(width, panel16() ? 2 : 1)) {
+        // in 8 bit mode the rectangle gets the same color as the pixels
+        if (bitDepth16)
+            drawRect(x1, y, width, 1, true, color);
+        else
+            drawRect(x1, y, width, 1, true, (uint8_t) color);
+        return;
+    }
+    
+    setX(x1, x2);
+    setY(y, y);
+    startTransfer();
+    if (bitDepth16)
+        PS_sendPixels<PSFormatRGB565>(color, width);
+    else if (expansion)
+        PS_sendPixels<PSFormatRGB565>(expansion[(uint8_t) color], width);
+    else
+        PS_sendPixels<PSFormatRGB332>(color, width);
+    sending = true;
     endTransfer();
-    delayMicroseconds(400);
+    windowDone();
+}
+
+void PocketStar::rasterSpan(void *display, int16_t x1, int16_t x2, int16_t y, uint16_t color) {
+    ((PocketStar *) display)->span(x1, x2, y, color);
 }
 
 // pixel manipulation
 void PocketStar::drawPixel(uint8_t x, uint8_t y, uint16_t color) {
     if (x > xMax || y > yMax)
         return;
+    if (shadow) {
+        shadow->sync();
+        shadow->put(x, y, bitDepth16 ? shadow->native(color) : shadowColor((uint8_t) color));
+        return;
+    }
+    beginBatch();
     goTo(x, y);
     startTransfer();
     if (bitDepth16)
-        PocketStar_SPI->transfer(color >> 8);
-    PocketStar_SPI->transfer(color);
+        PSFormatRGB565::send(color);
+    else if (expansion)
+        PSFormatRGB565::send(expansion[(uint8_t) color]);
+    else
+        PSFormatRGB332::send(color);
+    sending = true;
     endTransfer();
+    endBatch();
+}
+
+void PocketStar::fillWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color) {
+    if (shadow) {
+        if (x <= xMax && y <= yMax)
+            shadow->rect(x, y, width, height, true, shadowColor(color));
+        return;
+    }
+    fillWindow(x, y, width, height, color16(color));
+}
+
+void PocketStar::fillWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint16_t color) {
+    if (x > xMax || y > yMax || width == 0 || height == 0)
+        return;
+    width = PS_min(width, xMax + 1 - x);
+    height = PS_min(height, yMax + 1 - y);
+    if (shadow) {
+        shadow->rect(x, y, width, height, true, shadow->native(color));
+        return;
+    }
+    
+    // the pattern is read while the transfer runs, the line buffer not used by the last transfer is free
+    lineBufferIndex ^= 1;
+    uint8_t *pattern = lineBuffers[lineBufferIndex];
+    uint16_t length = 1;
+    if (!panel16())
+        pattern[0] = PS_color8(color);
+    else if ((color >> 8) == (color & 0xFF))
+        pattern[0] = color;
+    else {
+        // a whole line buffer, so the loop of the transfer runs through fewer blocks
+        for (uint8_t i = 0; i < sizeof(lineBuffers[0]); i += 2) {
+            pattern[i] = color >> 8;
+            pattern[i + 1] = color;
+        }
+        length = sizeof(lineBuffers[0]);
+    }
+    uint8_t bytesPerPixel = panel16() ? 2 : 1;
+    
+    beginBatch();
+    while (height > 0) {
+        uint8_t part = height;
+        if (y < wrapRow() && y + height > wrapRow())
+            part = wrapRow() - y;
+        setX(x, x + width - 1);
+        setY(y, y + part - 1);
+        startTransfer();
+        transfer.repeat(pattern, length, ((uint32_t) width) * part * bytesPerPixel);
+        y += part;
+        height -= part;
+    }
+    endBatch();
+    windowDone();
 }
 
 void PocketStar::setX(uint8_t start, uint8_t end) {
@@ -310,11 +1075,17 @@ void PocketStar::setX(uint8_t start, uint8_t end) {
         start = xMax;
     if(end > xMax)
         end = xMax;
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_SET_COLOUMN);
-    PocketStar_SPI->transfer(start);
-    PocketStar_SPI->transfer(end);
-    endTransfer();
+    if (start == cachedColumnStart && end == cachedColumnEnd && columnHome) {
+        skippedCommands++;
+        return;
+    }
+    cachedColumnStart = start;
+    cachedColumnEnd = end;
+    columnHome = true;
+    command(COMMAND_SET_COLOUMN);
+    command(start);
+    command(end);
+    commandDone();
 }
 
 void PocketStar::setY(uint8_t start, uint8_t end) {
@@ -322,22 +1093,43 @@ void PocketStar::setY(uint8_t start, uint8_t end) {
         start = yMax;
     if(end > yMax)
         end = yMax;
-    startCommandTransfer();
-    PocketStar_SPI->transfer(COMMAND_SET_ROW);
-    PocketStar_SPI->transfer(start);
-    PocketStar_SPI->transfer(end);
-    endTransfer();
+    // screen rows to display memory rows, a window crossing the wrap ends at the last memory row
+    start = (start + scrollY) & yMax;
+    end = (end + scrollY) & yMax;
+    if (end < start)
+        end = yMax;
+    if (start == cachedRowStart && end == cachedRowEnd && rowHome) {
+        skippedCommands++;
+        return;
+    }
+    cachedRowStart = start;
+    cachedRowEnd = end;
+    rowHome = true;
+    command(COMMAND_SET_ROW);
+    command(start);
+    command(end);
+    commandDone();
 }
 
 void PocketStar::goTo(uint8_t x, uint8_t y) {
     if(x > xMax || y > yMax)
         return;
+    beginBatch();
     setX(x, xMax);
     setY(y, yMax);
+    endBatch();
 }
 
 void PocketStar::writeBuffer(const uint8_t *buffer, int count) {
     uint8_t temp;
+    if (expansion && !bitDepth16) {
+        transfer.wait();
+        for (int i = 0; i < count; i++)
+            PSFormatRGB565::send(expansion[buffer[i]]);
+        sending = true;
+        return;
+    }
+    transfer.wait();
     PS_send(buffer[0]);
     for (int i = 1; i < count; i++) {
         temp = buffer[i];
@@ -345,10 +1137,12 @@ void PocketStar::writeBuffer(const uint8_t *buffer, int count) {
         PS_send(temp);
     }
     PS_wait();
+    sending = true;
 }
 
 void PocketStar::writeBuffer(const uint16_t *buffer, int count) {
     uint16_t temp;
+    transfer.wait();
     PS_send(buffer[0] >> 8);
     PS_wait();
     PS_send(buffer[0]);
@@ -360,32 +1154,133 @@ void PocketStar::writeBuffer(const uint16_t *buffer, int count) {
         PS_send(temp);
     }
     PS_wait();
+    sending = true;
+}
+
+void PocketStar::writeBufferAsync(const uint8_t *buffer, int count) {
+    stream(buffer, count, expansion && !bitDepth16);
+}
+
+// sends the data by DMA. expanded pixels are converted into the line buffers, a row at a time
+void PocketStar::stream(const uint8_t *data, uint32_t count, boolean expand) {
+    while (count > 0) {
+        if (expand) {
+            uint8_t chunk = PS_min(count, 96);
+            lineBufferIndex ^= 1;
+            uint8_t *buffer = lineBuffers[lineBufferIndex];
+            PS_expandPixels(buffer, data, chunk, expansion);
+            transfer.start(buffer, chunk << 1);
+            data += chunk;
+            count -= chunk;
+        } else {
+            uint16_t chunk = PS_min(count, 0xFFFF);
+            transfer.start(data, chunk);
+            data += chunk;
+            count -= chunk;
+        }
+    }
+}
+
+boolean PocketStar::transferDone(void) {
+    return !transfer.busy();
+}
+
+void PocketStar::waitForTransfer(void) {
+    transfer.wait();
+}
+
+void PocketStar::setTransferCallback(PSTransferCallback callback) {
+    transfer.setCallback(callback);
+}
+
+void PocketStar::setShadow(PSCanvas *canvas) {
+    shadow = canvas;
+}
+
+PSCanvas *PocketStar::getShadow(void) {
+    return shadow;
+}
+
+void PocketStar::flush(void) {
+    if (!shadow)
+        return;
+    // the canvas switches to its own bit depth while sending and back to ours afterwards
+    shadow->flush();
 }
 
 // drawing images and sprites
-void PocketStar::drawImage(uint8_t x, uint8_t y, const PSImage *image) {
-    if(x < 0 || y < 0 || x > xMax || y > yMax)
+void PocketStar::drawImage(int16_t x, int16_t y, const PSImage *image) {
+    drawImageRegion(x, y, image, 0, 0, image->width, image->height);
+}
+
+void PocketStar::drawFrame(int16_t x, int16_t y, const PSAtlas *atlas, uint8_t frame) {
+    const PSFrame *f = &atlas->frames[frame];
+    drawImageRegion(x, y, atlas->image, f->x, f->y, f->width, f->height);
+}
+
+void PocketStar::drawImageRegion(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height) {
+    if (shadow) {
+        shadow->drawImageRegion(x, y, image, srcX, srcY, width, height);
+        return;
+    }
+    if (srcX >= image->width || srcY >= image->height)
         return;
     
-    uint8_t width = image->width;
-    uint8_t height = image->height;
-    uint32_t datalength = ((uint32_t) width) * height;
-    uint16_t bitDepth16 = image->bitDepth == BitDepth16;
-    uint16_t cur;
+    // clip the region to the image and the screen
+    int16_t w = PS_min(width, image->width - srcX);
+    int16_t h = PS_min(height, image->height - srcY);
+    if (x < 0) {
+        srcX -= x;
+        w += x;
+        x = 0;
+    }
+    if (y < 0) {
+        srcY -= y;
+        h += y;
+        y = 0;
+    }
+    w = PS_min(w, xMax + 1 - x);
+    h = PS_min(h, yMax + 1 - y);
+    if (w <= 0 || h <= 0)
+        return;
     
-    if (bitDepth16)
-        datalength = datalength << 1;
+    if (image->encoding == EncodingSpans) {
+        spanRows(x, y, w, h, image, srcX, srcY);
+        return;
+    }
+    if (image->encoding != EncodingRaw || PS_isIndexed(image)) {
+        decodeRows(x, y, w, h, image, srcX, srcY);
+        return;
+    }
     
-    setX(x, x + width - 1);
-    setY(y, y + height - 1);
+    uint8_t bytesPerPixel = image->bitDepth == BitDepth16 ? 2 : 1;
+    uint16_t stride = image->width * bytesPerPixel;
     
-    startTransfer();
-    for (int i = 0; i < datalength; i++) {
-        cur = image->data[i];
-        PS_wait();
-        PS_send(cur);
+    // the image is sent by DMA, the next command waits for it
+    writeRows(x, y, w, h, bytesPerPixel, image->data + srcY * stride + srcX * bytesPerPixel, stride);
+}
+
+// copies the opaque spans of a sprite row which lie in the columns first to first + count - 1 of the image.
+// column first goes to dst[0], mirrored sprites are written from dst[count - 1] backwards
+static void PS_copySpans(uint8_t *dst, const uint8_t *row, uint8_t first, uint8_t count, boolean mirror) {
+    uint8_t numSpans = *row++;
+    while (numSpans--) {
+        uint8_t column = row[0];
+        uint8_t length = row[1];
+        const uint8_t *pixels = row + 2;
+        row += 2 + length;
+        int16_t begin = PS_max(column, first);
+        int16_t end = PS_min(column + length, first + count);
+        if (begin >= end)
+            continue;
+        if (!mirror)
+            memcpy(dst + begin - first, pixels + begin - column, end - begin);
+        else {
+            uint8_t *p = dst + count - 1 - (begin - first);
+            for (int16_t i = begin; i < end; i++)
+                *p-- = pixels[i - column];
+        }
     }
-    endTransfer();
 }
 
 void PocketStar::drawSprites(const PSSprite *sprites[], uint8_t numSprites, uint8_t background, uint8_t ySkip) {
@@ -399,48 +1294,137 @@ void PocketStar::drawSprites(const PSSprite *sprites[], uint8_t numSprites, cons
 void PocketStar::drawSprites(const PSSprite *sprites[], uint8_t numSprites, const PSImage *backgroundImg, uint8_t backgroundCol, boolean image, uint8_t ySkip) {
     if (ySkip >= 64)
         return;
+    numSprites = PS_min(numSprites, PS_MAX_SPRITES);
     if (image && (backgroundImg->width != 96 || backgroundImg->height != 64))
         return;
+    if (shadow) {
+        if (image)
+            shadow->drawImageRegion(0, ySkip, backgroundImg, 0, ySkip, 96, 64 - ySkip);
+        else
+            shadow->drawRect(0, ySkip, 96, 64 - ySkip, true, backgroundCol);
+        shadow->drawSprites(sprites, numSprites);
+        return;
+    }
+    
+    // a compressed or indexed background is decoded row by row, the only decoder (and LZ window) on the stack
+    PSImageDecoder decoder;
+    uint8_t colors[96];
+    boolean decoded = image && (backgroundImg->encoding != EncodingRaw || PS_isIndexed(backgroundImg));
+    if (decoded) {
+        decoder.begin(backgroundImg);
+        decoder.skip(ySkip * 96);
+    }
     
-    uint8_t buffer[96];
+    // sprites which are not on the screen are dropped, the others are sorted by their first row (a counting sort,
+    // which keeps the order of the array). while the rows are composed, only the sprites crossing the row are looked at
+    uint8_t top[PS_MAX_SPRITES], bottom[PS_MAX_SPRITES], order[PS_MAX_SPRITES], active[PS_MAX_SPRITES];
+    uint8_t starts[65];
+    uint8_t numVisible = 0;
+    memset(starts, 0, sizeof(starts));
+    for (uint8_t i = 0; i < numSprites; i++) {
+        const PSSprite *sprite = sprites[i];
+        top[i] = 0xFF;
+        if (!sprite->enabled)
+            continue;
+        int16_t first = PS_max(sprite->y, ySkip);
+        int16_t last = PS_min(sprite->y + PS_spriteHeight(sprite) - 1, yMax);
+        if (first > last || sprite->x > xMax || sprite->x + PS_spriteWidth(sprite) <= 0)
+            continue;
+        top[i] = first;
+        bottom[i] = last;
+        starts[first + 1]++;
+        numVisible++;
+    }
+    for (uint8_t row = 1; row <= 64; row++)
+        starts[row] += starts[row - 1];
+    for (uint8_t i = 0; i < numSprites; i++) {
+        if (top[i] != 0xFF)
+            order[starts[top[i]]++] = i;
+    }
+    uint8_t next = 0, numActive = 0;
+    
+    // two line buffers: while one row is sent by DMA, the next one is composed in the other buffer
+    beginBatch();
     goTo(0, ySkip);
     startTransfer();
     for (uint8_t y = ySkip; y < 64; y++) {
-        if (image) {
+        if (y == wrapRow() && y != ySkip) {
+            setY(y, yMax);
+            startTransfer();
+        }
+        lineBufferIndex ^= 1;
+        // with the color expansion the row is composed in the second half and expanded into the whole buffer
+        uint8_t *buffer = lineBuffers[lineBufferIndex] + (expansion ? 96 : 0);
+        if (decoded)
+            decoder.read(buffer, 96);
+        else if (image) {
             const uint8_t *first = backgroundImg->data + y * 96;
             memcpy(buffer, first, 96);
         } else
             memset(buffer, backgroundCol, 96);
         
-        for (uint8_t i = 0; i < numSprites; i++) {
-            if (sprites[i]->enabled) {
-                if (sprites[i]->y <= y && y <= sprites[i]->y + sprites[i]->image->height - 1) {
-                    uint8_t begin = PS_max(sprites[i]->x, 0);
-                    uint8_t end = PS_min(sprites[i]->x + sprites[i]->image->width, 96);
-                    if (begin > end)
-                        continue;
-                    
-                    const uint8_t *spriteDataBegin = sprites[i]->image->data + (y - sprites[i]->y) * sprites[i]->image->width - sprites[i]->x + begin;
-                    uint8_t *bufferBegin = buffer + begin;
-                    uint8_t d = end - begin;
-                    if (!sprites[i]->mirrorFlag) {
-                        for (uint8_t j = 0; j < d; j++) {
-                            if (spriteDataBegin[j] != ALPHA)
-                                bufferBegin[j] = spriteDataBegin[j];
-                        }
-                    } else {
-                        for (uint8_t j = 0; j < d; j++) {
-                            if (spriteDataBegin[d - j - 1] != ALPHA)
-                                bufferBegin[j] = spriteDataBegin[d - j - 1];
-                        }
-                    }
+        // sprites starting on this row become active, the active ones are drawn in the order of the array
+        while (next < numVisible && top[order[next]] == y) {
+            uint8_t i = order[next++];
+            uint8_t k = numActive++;
+            for (; k > 0 && active[k - 1] > i; k--)
+                active[k] = active[k - 1];
+            active[k] = i;
+        }
+        
+        for (uint8_t k = 0; k < numActive; k++) {
+            const PSSprite *sprite = sprites[active[k]];
+            const PSImage *source = PS_spriteImage(sprite);
+            uint8_t width = PS_spriteWidth(sprite);
+            uint8_t begin = PS_max(sprite->x, 0);
+            uint8_t end = PS_min(sprite->x + width, 96);
+            uint8_t d = end - begin;
+            // mirrored sprites are read from the right, their first visible column is the last one read
+            uint8_t column = sprite->mirrorFlag ? sprite->x + width - end : begin - sprite->x;
+            if (source->encoding == EncodingSpans) {
+                PS_copySpans(buffer + begin, PS_spanRow(source, PS_spriteTop(sprite) + y - sprite->y), PS_spriteLeft(sprite) + column, d, sprite->mirrorFlag);
+                continue;
+            }
+            uint32_t offset = PS_spriteOffset(sprite) + (y - sprite->y) * PS_spriteStride(sprite) + column;
+            
+            const uint8_t *spriteDataBegin;
+            if (PS_isIndexed(source)) {
+                // indexed sprites are unpacked into colors first
+                PS_readIndexed(source, offset, d, colors);
+                spriteDataBegin = colors;
+            } else
+                spriteDataBegin = source->data + offset;
+            uint8_t *bufferBegin = buffer + begin;
+            if (!sprite->mirrorFlag) {
+                for (uint8_t j = 0; j < d; j++) {
+                    if (spriteDataBegin[j] != ALPHA)
+                        bufferBegin[j] = spriteDataBegin[j];
+                }
+            } else {
+                for (uint8_t j = 0; j < d; j++) {
+                    if (spriteDataBegin[d - j - 1] != ALPHA)
+                        bufferBegin[j] = spriteDataBegin[d - j - 1];
                 }
             }
         }
         
-        writeBuffer(buffer, 96);
+        // sprites ending on this row are done
+        uint8_t kept = 0;
+        for (uint8_t k = 0; k < numActive; k++) {
+            if (bottom[active[k]] != y)
+                active[kept++] = active[k];
+        }
+        numActive = kept;
+        
+        if (expansion) {
+            PS_expandPixels(lineBuffers[lineBufferIndex], buffer, 96, expansion);
+            stream(lineBuffers[lineBufferIndex], 192, false);
+        } else
+            stream(buffer, 96, false);
     }
-    endTransfer();
+    endBatch();
+    if (!panel16() || expansion)
+        windowDone();
 }
 
 // printing text
@@ -480,6 +1464,20 @@ size_t PocketStar::write(uint8_t c) {
         return 1;
     if (cursorX > xMax || cursorY > yMax)
         return 1;
+    if (shadow) {
+        shadow->fontHeight = fontHeight;
+        shadow->fontFirstChar = fontFirstChar;
+        shadow->fontLastChar = fontLastChar;
+        shadow->fontDescriptor = fontDescriptor;
+        shadow->fontBitmap = fontBitmap;
+        shadow->fontColor = bitDepth16 ? shadow->native(fontColor) : shadowColor((uint8_t) fontColor);
+        shadow->fontColorBackground = bitDepth16 ? shadow->native(fontColorBackground) : shadowColor((uint8_t) fontColorBackground);
+        shadow->cursorX = cursorX;
+        shadow->cursorY = cursorY;
+        shadow->write(c);
+        cursorX = shadow->cursorX;
+        return 1;
+    }
     
     uint8_t charWidth = pgm_read_byte(&fontDescriptor[c - fontFirstChar].width);
     uint8_t bytesPerRow = charWidth / 8;
@@ -487,47 +1485,20 @@ size_t PocketStar::write(uint8_t c) {
         bytesPerRow++;
     uint16_t offset = pgm_read_word(&fontDescriptor[c - fontFirstChar].offset) + (bytesPerRow * fontHeight) - 1;
     
+    beginBatch();
     setX(cursorX, cursorX + charWidth + 1);
-    setY(cursorY, cursorY + fontHeight);
+    setY(cursorY, cursorY + fontHeight - 1);
     
-    startTransfer();
-    for (uint8_t y = 0; y < fontHeight && y + cursorY < yMax + 1; y++) {
-        if (bitDepth16) {
-            PS_send(fontColorBackground >> 8);
-            PS_wait();
-        }
-        PS_send(fontColorBackground);
-        for (uint8_t byte = 0; byte < bytesPerRow; byte++) {
-            uint8_t data = pgm_read_byte(fontBitmap + offset - y - ((bytesPerRow - byte - 1) * fontHeight));
-            uint8_t bits = byte * 8;
-            for (uint8_t i = 0; i < 8 && (bits + i) < charWidth && (bits + i + cursorX) < xMax; i++) {
-                PS_wait();
-                if (data & (0x80 >> i)) {
-                    if (bitDepth16) {
-                        PS_send(fontColor >> 8);
-                        PS_wait();
-                    }
-                    PS_send(fontColor);
-                 } else {
-                    if (bitDepth16) {
-                        PS_send(fontColorBackground >> 8);
-                        PS_wait();
-                    }
-                    PS_send(fontColorBackground);
-                }
-            }
-        }
-        PS_wait();
-        if ((cursorX + charWidth) < xMax) {
-            if (bitDepth16) {
-                PS_send(fontColorBackground >> 8);
-                PS_wait();
-            }
-            PS_send(fontColorBackground);
-            PS_wait();
-        }
-    }
-    endTransfer();
+    if (bitDepth16)
+        glyph<PSFormatRGB565>(charWidth, bytesPerRow, offset, fontColor, fontColorBackground);
+    else if (expansion)
+        glyph<PSFormatRGB565>(charWidth, bytesPerRow, offset, expansion[(uint8_t) fontColor], expansion[(uint8_t) fontColorBackground]);
+    else
+        glyph<PSFormatRGB332>(charWidth, bytesPerRow, offset, fontColor, fontColorBackground);
+    endBatch();
+    // nothing was clipped, so the window was filled exactly
+    if (cursorX + charWidth < xMax && cursorY + fontHeight - 1 <= yMax)
+        windowDone();
     cursorX += (charWidth + 1);
     return 1;
 }
@@ -642,12 +1613,22 @@ void PocketStar::saveVariables() {
     xfontColorBackground = fontColorBackground;
     xfontDescriptor = fontDescriptor;
     xfontBitmap = fontBitmap;
+    // a running scroll would move the pause menu, and the canvas could not tell what is on the display
+    stopScroll();
+    // the pause menu draws directly on the display
+    flush();
+    xshadow = shadow;
+    shadow = NULL;
+    // the pause menu draws its 8 bit images without leaving 16 bit mode
+    xexpansion = expansion;
+    setColorExpansion(true, expansion);
 }
 
 void PocketStar::restoreVariables() {
     bitDepth16 = xbitDepth16;
     colorModeBGR = xcolorModeBGR;
     mirror = xmirror;
+    expansion = xexpansion;
     writeRemap();
     fontHeight = xfontHeight;
     fontFirstChar = xfontFirstChar;
@@ -656,6 +1637,12 @@ void PocketStar::restoreVariables() {
     fontColorBackground = xfontColorBackground;
     fontDescriptor = xfontDescriptor;
     fontBitmap = xfontBitmap;
+    shadow = xshadow;
+    // the canvas still holds the picture from before the pause menu, send all of it again
+    if (shadow) {
+        shadow->markDirty(shadow->originX, shadow->originY, shadow->width, shadow->height);
+        flush();
+    }
 }
 
 
@@ -680,6 +1667,7 @@ long _flashTimer;
 const float _VIBRATE_TIMER = 0.1;
 boolean _vibrating;
 float _vibrationTimer;
+boolean _gameDimmed;
 const int LOADING_IMAGE_TIMER = 1500;
 float _lastBatteryImageChange;
 
@@ -774,6 +1762,8 @@ void _enterPauseMenu() {
     if (_paused)
         return;
     _paused = true;
+    // dimming changes the display memory, only a shadow canvas can bring the game back afterwards
+    _gameDimmed = pocketstar.getShadow() != NULL;
     pocketstar.saveVariables();
     pocketstar.vibrate(false);
     _lastBatteryImageChange = 1000;
@@ -878,7 +1868,13 @@ void _drawPauseMenu(boolean full) {
     pocketstar.setFont(pocketStar6pt);
     pocketstar.setFontColor(CYAN_16b, DARKBLUE_16b);
     if (full) {
-        pocketstar.drawRect(12, 9, 72, 45, true, DARKBLUE_16b);
+        if (_gameDimmed) {
+            // darken the game instead of painting over it, the menu area a bit more
+            pocketstar.dimWindow(0, 0, 96, 64);
+            pocketstar.dimWindow(12, 9, 72, 45);
+        } else {
+            pocketstar.drawRect(12, 9, 72, 45, true, DARKBLUE_16b);
+        }
     }
     pocketstar.setCursor(13, 10);
     pocketstar.print("SETTINGS");
@@ -916,7 +1912,6 @@ void _drawPauseMenu(boolean full) {
         }
     }
     
-    pocketstar.setBitDepth(BitDepth8);
     if (!pocketstar.isCharging()) {
         if (_lastBatteryImageChange > 60) {
             _lastBatteryImageChange = 0;
@@ -938,8 +1933,6 @@ void _drawPauseMenu(boolean full) {
         _lastBatteryImageChange = 1000;
     }
     
-    pocketstar.setBitDepth(BitDepth16);
-    
     pocketstar.drawRect(11, 8, 74, 47, false, BLACK_16b);
 }
 
@@ -954,6 +1947,8 @@ void _goIntoStandby(boolean canResume) {
     delay(1000);
     attachInterrupt(PIN_BUTTON_PAUSE, _nothing, LOW);
     _standbyMode();
+    // the controller may have lost its state, before anything is drawn again
+    pocketstar.invalidateCache();
     if (_paused || pause()) {
         _enterPauseMenu();
     } else if (canResume) {
@@ -1017,4 +2012,27 @@ void _saveSettings() {
     _file.write(_ledInMenu);
     _file.write(_standbyNr);
     _file.close();
-}
\ No newline at end of file
+}
+
+template <class Format> void PocketStar::glyph(uint8_t charWidth, uint8_t bytesPerRow, uint16_t offset, uint16_t color, uint16_t colorBackground) {
+    startTransfer();
+    for (uint8_t y = 0; y < fontHeight && y + cursorY < yMax + 1; y++) {
+        if (y > 0 && y + cursorY == wrapRow()) {
+            sending = true;
+            endTransfer();
+            setY(y + cursorY, cursorY + fontHeight - 1);
+            startTransfer();
+        }
+        Format::send(colorBackground);
+        for (uint8_t byte = 0; byte < bytesPerRow; byte++) {
+            uint8_t data = pgm_read_byte(fontBitmap + offset - y - ((bytesPerRow - byte - 1) * fontHeight));
+            uint8_t bits = byte * 8;
+            for (uint8_t i = 0; i < 8 && (bits + i) < charWidth && (bits + i + cursorX) < xMax; i++)
+                Format::send((data & (0x80 >> i)) ? color : colorBackground);
+        }
+        if ((cursorX + charWidth) < xMax)
+            Format::send(colorBackground);
+    }
+    sending = true;
+    endTransfer();
+}
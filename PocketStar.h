@@ -1,6 +1,6 @@
 /*
 PocketStar.h
-Last modified 09 Jan 2019
+Last modified 17 Oct 2026
 
 This file is part of the PocketStar Library.
 
@@ -30,14 +30,25 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "PS_FontDefinitions.h"
 #include "PS_Fonts.h"
 #include "PS_Images.h"
+#include "PS_Decoder.h"
+#include "PS_Shapes.h"
 #include "PS_PauseMenuImages.h"
 #include "PS_Sprites.h"
+#include "PS_Transfer.h"
+#include "PS_Canvas.h"
+#include "PS_DisplayList.h"
+#include "PS_PointBatch.h"
 
 #define _SETTINGS_FILE "pocketstar.settings"
 
 const uint8_t ColorModeRGB = 0;
 const uint8_t ColorModeBGR = 1;
 
+const uint8_t ScrollInterval6     = 0;    // frames between two scroll steps
+const uint8_t ScrollInterval10    = 1;
+const uint8_t ScrollInterval100   = 2;
+const uint8_t ScrollInterval200   = 3;
+
 const uint8_t ButtonUp      = 1 << 0;
 const uint8_t ButtonDown    = 1 << 1;
 const uint8_t ButtonLeft    = 1 << 2;
@@ -90,33 +101,96 @@ class PocketStar : public Print {
     // general control
     void startTransfer(void);
     void endTransfer(void);
+    // everything between beginBatch() and endBatch() is sent with a single chip select
+    void beginBatch(void);
+    void endBatch(void);
     void on(void);
     void off(void);
     void setMirror(boolean mirror);
     void setBitDepth(uint8_t bitDepth);
+    // keeps the display in 16 bit mode: 8 bit pixels are expanded to 16 bit through a table of 256 colors while
+    // they are sent, so setBitDepth() sends no command and 8 bit images and sprites can be drawn in both bit depths.
+    // NULL selects the built-in table, makeExpansionTable() fills one with gamma correction
+    void setColorExpansion(boolean expand, const uint16_t *table = NULL);
+    static void makeExpansionTable(uint16_t *table, float gamma);
     void setColorMode(uint8_t colorMode);
     void setBrightness(uint8_t brightness);
+    void setContrast(uint8_t red, uint8_t green, uint8_t blue);
+    
+    // controller state cache: commands which would not change anything are not sent.
+    // call invalidateCache() when the controller may have lost its state
+    void invalidateCache(void);
+    uint32_t getSkippedCommands(void);
     
     // accelerated graphics commands
     void clearWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
     void clearScreen(void);
-    void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color);
-    void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint16_t color);
-    void drawLine(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t red, uint8_t green, uint8_t blue);
+    // darkens a window in the display memory. a shadow canvas keeps the undimmed pixels
+    void dimWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+    // lines are clipped to the screen and sent as a single command, the end points may be off the screen
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+    void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t red, uint8_t green, uint8_t blue);
     void drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint8_t color);
     void drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint16_t color);
     void drawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, boolean fill, uint8_t red, uint8_t green, uint8_t blue);
+    void copyWindow(uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height, uint8_t dstX, uint8_t dstY);
+    void scrollWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t dx, int8_t dy);
+    void repeatWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t columns, uint8_t rows);
+    void scrollConsole(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
+    
+    // hardware scrolling
+    // the scroll origin is the display memory row shown at the top of the screen. drawing coordinates
+    // always refer to the screen, so changing the origin moves the content without sending any pixels
+    void setScrollOrigin(uint8_t y);
+    uint8_t getScrollOrigin(void);
+    // continuous scrolling of the rows firstRow to firstRow + numRows - 1 by the controller, dx columns and dy rows
+    // per step
+    // the display memory has to be redrawn after stopScroll()
+    void startScroll(uint8_t dx, uint8_t dy, uint8_t firstRow = 0, uint8_t numRows = 64, uint8_t interval = ScrollInterval6);
+    void stopScroll(void);
+    boolean isScrolling(void);
+    
+    // shapes, cut into rows which are sent as pixels or drawn as a rectangle, whatever is faster. radii go up to 127
+    void drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint8_t color);
+    void drawCircle(int16_t x, int16_t y, int16_t radius, boolean fill, uint16_t color);
+    void drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint8_t color);
+    void drawEllipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color);
+    void drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint8_t color);
+    void drawTriangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3, boolean fill, uint16_t color);
+    // filled polygons have to be convex
+    void drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint8_t color);
+    void drawPolygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color);
     
     // pixel manipulation
     void drawPixel(uint8_t x, uint8_t y, uint16_t color);
+    // fills a window with one color by DMA, no buffer needed. like writeBufferAsync() the transfer is left running
+    void fillWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color);
+    void fillWindow(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint16_t color);
     void setX(uint8_t start, uint8_t end);
     void setY(uint8_t start, uint8_t end);
     void goTo(uint8_t x, uint8_t y);
     void writeBuffer(const uint8_t *buffer, int count);
     void writeBuffer(const uint16_t *buffer, int count);
     
+    // asynchronous transfer, call after startTransfer(). the next command or endTransfer() waits for it
+    void writeBufferAsync(const uint8_t *buffer, int count);
+    boolean transferDone(void);
+    void waitForTransfer(void);
+    void setTransferCallback(PSTransferCallback callback);
+    
+    // shadow framebuffer: while set, drawing goes into the canvas and flush() sends the changed parts
+    void setShadow(PSCanvas *canvas);
+    PSCanvas *getShadow(void);
+    void flush(void);
+    
     // drawing images and sprites
-    void drawImage(uint8_t x, uint8_t y, const PSImage *image);
+    // images may be partly off the screen, only the visible part is sent
+    void drawImage(int16_t x, int16_t y, const PSImage *image);
+    // draws the part of the image starting at (srcX, srcY), e.g. one frame of a sprite sheet
+    void drawImageRegion(int16_t x, int16_t y, const PSImage *image, uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height);
+    void drawFrame(int16_t x, int16_t y, const PSAtlas *atlas, uint8_t frame);
+    // up to PS_MAX_SPRITES sprites, later ones in the array are drawn on top
     void drawSprites(const PSSprite *sprites[], uint8_t numSprites, uint8_t background = BLACK_8b, uint8_t ySkip = 0);
     void drawSprites(const PSSprite *sprites[], uint8_t numSprites, const PSImage *background, uint8_t ySkip = 0);
     
@@ -159,17 +233,61 @@ class PocketStar : public Print {
     const PSCharInfo *fontDescriptor;
     const unsigned char *fontBitmap;
     SPIClass *PocketStar_SPI;
+    PSTransfer transfer;
+    PSCanvas *shadow;
+    uint8_t lineBuffers[2][192];
+    uint8_t lineBufferIndex;
+    uint8_t scrollY;
+    boolean scrolling;
+    uint32_t busyStart, busyTime;
+    uint8_t cachedRemap, cachedFill, cachedBrightness;
+    uint8_t cachedColumnStart, cachedColumnEnd, cachedRowStart, cachedRowEnd;
+    uint16_t cachedContrast[3];
+    boolean columnHome, rowHome;    // address pointer at the start of the window
+    uint32_t skippedCommands;
+    uint8_t commands[32];
+    uint8_t commandCount, batchDepth;
+    boolean sending;    // bytes written to the SPI data register, maybe not shifted out yet
+    const uint16_t *expansion;  // 8 to 16 bit table while the color expansion is on
     
     boolean xbitDepth16, xcolorModeBGR, xmirror;
     uint8_t xcursorX, xcursorY, xfontHeight, xfontFirstChar, xfontLastChar;
     uint16_t xfontColor, xfontColorBackground;
     const PSCharInfo *xfontDescriptor;
     const unsigned char *xfontBitmap;
+    PSCanvas *xshadow;
+    const uint16_t *xexpansion;
     
-    void startCommandTransfer(void);
+    void command(uint8_t c);
+    void commandDone(void);
+    void sendCommands(void);
+    void settle(void);
+    void copy(uint8_t srcX, uint8_t srcY, uint8_t width, uint8_t height, uint8_t dstX, uint8_t dstY);
+    uint8_t wrapRow(void);
+    void setBusy(uint16_t time);
+    void waitForCommand(void);
+    void windowDone(void);
+    void writeRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, uint8_t bytesPerPixel, const uint8_t *data, uint16_t stride);
+    void decodeRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, const PSImage *image, uint8_t srcX, uint8_t srcY);
+    void spanRows(uint8_t x, uint8_t y, uint8_t width, uint8_t rows, const PSImage *image, uint8_t srcX, uint8_t srcY);
     void writeRemap(void);
+    boolean panel16(void);
+    uint16_t color16(uint8_t color);
+    uint16_t native(uint8_t color);
+    uint16_t native(uint16_t color);
+    uint16_t shadowColor(uint8_t color);
+    void stream(const uint8_t *data, uint32_t count, boolean expand);
+    void span(int16_t x1, int16_t x2, int16_t y, uint16_t color);
+    void ellipse(int16_t x, int16_t y, int16_t radiusX, int16_t radiusY, boolean fill, uint16_t color);
+    void polygon(const PSVertex *vertices, uint8_t numVertices, boolean fill, uint16_t color);
+    static void rasterSpan(void *display, int16_t x1, int16_t x2, int16_t y, uint16_t color);
+    template <class Format> void glyph(uint8_t charWidth, uint8_t bytesPerRow, uint16_t offset, uint16_t color, uint16_t colorBackground);
     void drawSprites(const PSSprite *sprites[], uint8_t numSprites, const PSImage *backgroundImg, uint8_t backgroundCol, boolean image, uint8_t ySkip = 0);
     virtual size_t write(uint8_t c);
+    
+    friend class PSCanvas;
+    friend class PSDisplayList;
+    friend class PSPointBatch;
 };
 
 extern PocketStar pocketstar;
@@ -0,0 +1,56 @@
+#include <PocketStar.h>
+
+// the same display list drawn with submit() into a shadow canvas and replayed into a strip has to give the same pixels.
+// the shadow takes 6 KB, the strip only 8 rows
+uint8_t submitted[96 * 64];
+uint8_t stripBuffer[96 * 8];
+PSDisplayCommand commands[16];
+PSDisplayList displayList(commands, 16);
+
+boolean checkDisplayList() {
+    displayList.clear();
+    displayList.setBackground(BLUE_8b);
+    displayList.drawRect(0, 0, 40, 20, true, RED_8b);
+    displayList.drawRect(30, 30, 40, 20, true, GREEN_8b);
+    // text partly off the screen
+    displayList.setFont(pocketStar12pt);
+    displayList.setFontColor(WHITE_8b, BLACK_8b);
+    displayList.drawText(-7, -4, "12345");
+    displayList.drawText(-20, 35, "9876");
+    displayList.drawText(75, 55, "7777");
+
+    PSCanvas submitCanvas(submitted, BitDepth8);
+    pocketstar.setShadow(&submitCanvas);
+    displayList.submit();
+    pocketstar.setShadow(NULL);
+
+    PSCanvas strip(stripBuffer, BitDepth8, 96, 8);
+    for (uint8_t y = 0; y < 64; y += 8) {
+        strip.setOrigin(0, y);
+        strip.fillScreen(BLUE_8b);
+        displayList.replay(strip);
+        if (memcmp(submitted + y * 96, stripBuffer, sizeof(stripBuffer)) != 0)
+            return false;
+    }
+    return true;
+}
+
+void initialize() {
+    boolean displayListOk = checkDisplayList();
+
+    pocketstar.drawRect(0, 0, 96, 64, true, BLACK_16b);
+    pocketstar.setFont(pocketStar7pt);
+    pocketstar.setFontColor(displayListOk ? GREEN_16b : RED_16b, BLACK_16b);
+    pocketstar.setCursor(2, 2);
+    pocketstar.print(displayListOk ? "display list ok" : "display list FAIL");
+}
+
+void update(float tpf) {
+
+}
+
+boolean pause() {
+    return true;
+}
+
+void resume() {}
@@ -50,8 +50,12 @@ static uint8_t infoPages = 3;
 static uint8_t statusPages = 2;
 static uint8_t creditsPages = 4;
 float lastBatteryChange = 0;
+PSPoint pointStorage[256]; // 8 columns of the color palette
+PSPointBatch points(pointStorage, 256);
 
 void initialize() {
+    // the menus mix 8 and 16 bit images, the display stays in 16 bit mode
+    pocketstar.setColorExpansion(true);
     pocketstar.setBacklightColor(_ledInMenu);
     changeMenu(MENU_TITLE);
     pocketstar.setFont(pocketStar7pt);
@@ -233,10 +237,10 @@ void changeMenu(uint8_t newMenu) {
     } else if (currentMenu == MENU_MAIN) {
         pocketstar.setBitDepth(BitDepth8);
         pocketstar.drawRect(0, 0, 96, 64, true, BLACK_16b);
-        drawImage(12, 3, &menuGamesImage);
-        drawImage(64, 2, &menuAppsImage);
-        drawImage(16, 35, &menuSettingsImage);
-        drawImage(64, 35, &menuInfoImage);
+        pocketstar.drawImage(12, 3, &menuGamesImage);
+        pocketstar.drawImage(64, 2, &menuAppsImage);
+        pocketstar.drawImage(16, 35, &menuSettingsImage);
+        pocketstar.drawImage(64, 35, &menuInfoImage);
         pocketstar.setFont(pocketStar7pt);
         pocketstar.setFontColor(WHITE_16b, BLACK_16b);
         pocketstar.setCursor(24 - pocketstar.getPrintWidth("Games")/2, 20);
@@ -463,15 +467,17 @@ void changeMenu(uint8_t newMenu) {
 }
 
 void aouHelper(uint8_t x, uint8_t y, uint16_t color) { // helps drawing a german / turkish a o u A O U with dots
-    pocketstar.drawPixel(x, y, color);
-    pocketstar.drawPixel(x + 3, y, color);
+    points.drawPixel(x, y, color);
+    points.drawPixel(x + 3, y, color);
+    points.submit();
 }
 
 void gHelper(uint8_t x, uint8_t y, uint16_t color) { // helps drawing a turkish g with breve
-    pocketstar.drawPixel(x, y, color);
-    pocketstar.drawPixel(x + 1, y + 1, color);
-    pocketstar.drawPixel(x + 2, y + 1, color);
-    pocketstar.drawPixel(x + 3, y, color);
+    points.drawPixel(x, y, color);
+    points.drawPixel(x + 1, y + 1, color);
+    points.drawPixel(x + 2, y + 1, color);
+    points.drawPixel(x + 3, y, color);
+    points.submit();
 }
 
 void calcInput(float deltaTime) {
@@ -845,8 +851,9 @@ void drawThumbnail(boolean g) {
     else
         file = apps.open(imgPath, FILE_READ);
     
-    //  signature: PSI                                                    version: 2          width and height: 96 & 64
-    if (file.read() != 'P' || file.read() != 'S' || file.read() != 'I' || file.read() != 2 || file.read() != 96 || file.read() != 64) {
+    //  signature: PSI                                                    version: 2 or 3     width and height: 96 & 64
+    int version = 0;
+    if (file.read() != 'P' || file.read() != 'S' || file.read() != 'I' || ((version = file.read()) != 2 && version != 3) || file.read() != 96 || file.read() != 64) {
         pocketstar.setBitDepth(BitDepth16);
         pocketstar.setFontColor(RED_16b, BLACK_16b);
         pocketstar.drawRect(0, 0, 96, 64, true, BLACK_16b);
@@ -862,17 +869,18 @@ void drawThumbnail(boolean g) {
     else
         pocketstar.setBitDepth(BitDepth8);
     
-    int datalines = 64;
-    if (bitDepth16)
-        datalines = datalines << 1;
+    // version 3 is compressed, the encoding follows the bit depth. the pixels are decoded a row at a time
+    uint8_t encoding = version == 3 ? file.read() : EncodingRaw;
+    PSImage thumbnail = {96, 64, (uint8_t) (bitDepth16 ? BitDepth16 : BitDepth8), NULL, encoding, NULL};
+    PSImageDecoder decoder(&thumbnail, &file);
     
-    uint8_t buffer[96];
+    uint8_t buffer[192];
     pocketstar.setX(0, 95);
     pocketstar.setY(0, 63);
     pocketstar.startTransfer();
-    for (int i = 0; i < datalines; i++) {
-        file.read(&buffer, 96);
-        pocketstar.writeBuffer(buffer, 96);
+    for (int i = 0; i < 64; i++) {
+        decoder.read(buffer, 96);
+        pocketstar.writeBuffer(buffer, bitDepth16 ? 192 : 96);
     }
     pocketstar.endTransfer();
     file.close();
@@ -917,15 +925,16 @@ void drawColorPalette() {
             uint8_t greenDark = green * (steps - 1 - y) / (steps - 1);
             uint8_t blueDark = blue * (steps - 1 - y) / (steps - 1);
             uint16_t colorDark = ((redDark >> 3) << 11) | ((greenDark >> 2) << 5) | (blueDark >> 3);
-            pocketstar.drawPixel(x, 32 + y, colorDark);
+            points.drawPixel(x, 32 + y, colorDark);
             
             uint8_t redBright = red + (255 - red) * y / (steps - 1);
             uint8_t greenBright = green + (255 - green) * y / (steps - 1);
             uint8_t blueBright = blue + (255 - blue) * y / (steps - 1);
             uint16_t colorBright = ((redBright >> 3) << 11) | ((greenBright >> 2) << 5) | (blueBright >> 3);
-            pocketstar.drawPixel(x, 31 - y, colorBright);
+            points.drawPixel(x, 31 - y, colorBright);
         }
     }
+    points.submit();
 }
 
 boolean pause() {
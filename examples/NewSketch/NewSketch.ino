@@ -19,4 +19,5 @@ boolean pause() {
 void resume() {
     // gets called after leaving pause menu or standby or screen
     // redraw the entire screen to ensure the pause menu is no longer visible
+    // (not needed while a shadow canvas is set, its content is sent again automatically)
 }
@@ -312,6 +312,7 @@ void draw(float tpf) {
         }
 
         objectSprites[i].enabled = true;
+        objectSprites[i].atlas = NULL;
         
         // set image according to object type
         switch (objects[i].type) {
@@ -322,21 +323,18 @@ void draw(float tpf) {
             case DIAMOND:   objectSprites[i].image = &diamond;  break;
             case STONE:     objectSprites[i].image = &stone;    break;
             case BOMB:      objectSprites[i].image = &bomb;     break;
-            case STAR:      if ((millis() % 300) < 150)
-                                objectSprites[i].image = &star;
-                            else
-                                objectSprites[i].image = &star2;
+            // stars and hearts blink, both frames are in one atlas image
+            case STAR:      objectSprites[i].atlas = &starAtlas;
+                            objectSprites[i].frame = (millis() % 300) < 150 ? 0 : 1;
                             break;
-            case HEART:     if ((millis() % 300) < 150)
-                                objectSprites[i].image = &heart;
-                            else
-                                objectSprites[i].image = &heart2;
+            case HEART:     objectSprites[i].atlas = &heartAtlas;
+                            objectSprites[i].frame = (millis() % 300) < 150 ? 0 : 1;
                             break;
         }
 
         // set sprite location
-        objectSprites[i].x = objects[i].x - objectSprites[i].image->width/2;
-        objectSprites[i].y = objects[i].y - objectSprites[i].image->height/2;
+        objectSprites[i].x = objects[i].x - PS_spriteWidth(&objectSprites[i])/2;
+        objectSprites[i].y = objects[i].y - PS_spriteHeight(&objectSprites[i])/2;
     }
     // update minecart sprite X location
     // image and Y location never change, so no need to update them
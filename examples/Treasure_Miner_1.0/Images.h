@@ -6,60 +6,60 @@
 
 // menu images
 // converter settings: convert to code, 8 bit, 1-dimensional, no alpha
-static const uint8_t PROGMEM titleData[96*64] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xC, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x28, 0x28, 0xC, 0x10, 0x10, 0x10, 0xC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x64, 0x48, 0x2C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x29, 0x64, 0x80, 0x80, 0x80, 0x84, 0x4C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x28, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x20, 0x60, 0x80, 0x60, 0x40, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x25, 0x41, 0x80, 0x80, 0x80, 0x80, 0x80, 0x68, 0xC, 0x10, 0x10, 0xC, 0x10, 0x8, 0x2, 0x2, 0x2, 0x25, 0x25, 0x24, 0x24, 0x44, 0x64, 0x80, 0x80, 0x80, 0x80, 0x80, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x24, 0x49, 0x24, 0x25, 0x2, 0x22, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x4C, 0xC, 0xC, 0xC, 0xC, 0x8, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x5, 0x44, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x44, 0x24, 0x29, 0x2D, 0x2D, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x2D, 0x51, 0x52, 0x52, 0x51, 0x29, 0x2, 0x2, 0x2, 0x41, 0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x8, 0x8, 0xC, 0x8, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x61, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0x2D, 0x2D, 0x4D, 0x51, 0x52, 0x51, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4E, 0x6, 0x2, 0x2, 0x2, 0x21, 0x40, 0x60, 0x60, 0x60, 0x60, 0x44, 0x8, 0x8, 0x9, 0x5, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x29, 0x4C, 0x4C, 0x68, 0x64, 0x64, 0x80, 0x60, 0x21, 0x6, 0x2A, 0x29, 0x2D, 0x2D, 0x4D, 0x51, 0x49, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4E, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x41, 0x40, 0x60, 0x60, 0x60, 0x44, 0x8, 0x2D, 0x2E, 0x2A, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x1, 0xD, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x48, 0x41, 0x1, 0x2, 0x2, 0x2, 0x6, 0x29, 0x2D, 0x2D, 0x29, 0x24, 0x24, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x51, 0x52, 0x52, 0x52, 0x52, 0x2A, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x20, 0x40, 0x40, 0x44, 0x4D, 0x52, 0x52, 0x71, 0x69, 0x45, 0x21, 0x1, 0x1, 0x1, 0x1, 0xD, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xC, 0x5, 0x1, 0x2, 0x2, 0x2, 0x2, 0x6, 0x29, 0x29, 0x4, 0x24, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x4D, 0x4D, 0x2D, 0x29, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x20, 0x24, 0x4D, 0x52, 0x52, 0x52, 0x31, 0x69, 0x80, 0x80, 0x80, 0x60, 0x1, 0x1, 0x9, 0x10, 0x10, 0x10, 0x10, 0x30, 0x10, 0x10, 0x10, 0xC, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x5, 0x4, 0x0, 0x24, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x2, 0x2, 0x1, 0x1, 0x1, 0x0, 0x2D, 0x52, 0x52, 0x52, 0x2D, 0x9, 0x44, 0x80, 0x80, 0x80, 0x80, 0x40, 0x4, 0xC, 0x10, 0x10, 0x10, 0x6C, 0x84, 0x68, 0x4C, 0x10, 0x8, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x1, 0x4, 0x4D, 0x2D, 0x2D, 0x29, 0x29, 0x4, 0x24, 0x80, 0x80, 0x80, 0x80, 0x80, 0x48, 0x10, 0x10, 0x10, 0x6C, 0x80, 0x80, 0x80, 0x80, 0x68, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x24, 0x4, 0x4, 0x4, 0x4, 0x20, 0x60, 0x80, 0x80, 0x80, 0x80, 0x64, 0xC, 0x10, 0x10, 0x6C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x24, 0x4, 0x0, 0x40, 0x60, 0x60, 0x80, 0x60, 0x60, 0xC, 0xC, 0xC, 0x68, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x0, 0x1, 0x1, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x40, 0x60, 0x60, 0x40, 0x8, 0xC, 0xC, 0x48, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0x8, 0x4, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x44, 0x2D, 0x2D, 0x2D, 0x28, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0xC, 0xC, 0xC, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x28, 0x64, 0x80, 0x80, 0x80, 0x80, 0x60, 0x44, 0xC, 0xC, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x69, 0x64, 0x64, 0x60, 0x60, 0x40, 0x8, 0x8, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM title = {96, 64, BitDepth8, titleData};
-static const uint8_t PROGMEM titleTextData[96*10] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM titleText = {96, 10, BitDepth8, titleTextData};
-static const uint8_t PROGMEM enterNameTextData[96*10] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM enterNameText = {96, 10, BitDepth8, enterNameTextData};
-static const uint8_t PROGMEM highScoresTextData[96*10] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM highScoresText = {96, 10, BitDepth8, highScoresTextData};
-static const uint8_t PROGMEM gameOverTextData[96*10] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM gameOverText = {96, 10, BitDepth8, gameOverTextData};
-static const uint8_t PROGMEM gameOverGemsData[8*42] = {0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x0, 0x0, 0x0};
-static PSImage PROGMEM gameOverGems = {8, 42, BitDepth8, gameOverGemsData};
+static const uint8_t PROGMEM titleData[839] = {0x0, 0x0, 0xDD, 0x0, 0x0, 0x92, 0x82, 0x0, 0x9C, 0x6, 0x81, 0x26, 0x8C, 0x14, 0x84, 0x3C, 0x83, 0x4, 0x98, 0x26, 0xBC, 0x5F, 0x82, 0xF, 0x85, 0x5F, 0x82, 0x2A, 0x8E, 0x26, 0x85, 0x84, 0x83, 0x1C, 0x86, 0x97, 0x92, 0xD, 0x87, 0x14, 0x88, 0xFC, 0x83, 0x17, 0x89, 0x8D, 0x87, 0x34, 0x87, 0x5F, 0x87, 0x75, 0x8F, 0xD4, 0x8E, 0xBF, 0x9A, 0x5F, 0x89, 0x42, 0xEA, 0x5F, 0x85, 0xD1, 0x88, 0xDC, 0x83, 0x58, 0x87, 0x5F, 0x86, 0x17, 0x86, 0x1C, 0x86, 0x2C, 0x83, 0x22, 0x87, 0x37, 0x85, 0x86, 0x84, 0x5F, 0x84, 0x1C, 0x95, 0xB1, 0x82, 0x14, 0x88, 0xD, 0x8D, 0x3A, 0x8F, 0x34, 0x82, 0x2D, 0x88, 0x24, 0x8B, 0x1C, 0x92, 0x5F, 0x88, 0x14, 0xA0, 0x5F, 0x8A, 0xEA, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0x8E, 0x0, 0x2, 0x4, 0xC, 0x8, 0xD5, 0x5A, 0x8, 0x24, 0x49, 0x28, 0x28, 0xC, 0x10, 0x10, 0x10, 0xC, 0xD4, 0x5D, 0x2, 0x64, 0x48, 0x2C, 0x80, 0x5D, 0x80, 0x0, 0x2, 0x24, 0x24, 0x24, 0xCE, 0x5D, 0x6, 0x29, 0x64, 0x80, 0x80, 0x80, 0x84, 0x4C, 0x82, 0x5F, 0x2, 0x28, 0x25, 0x25, 0x80, 0x62, 0x81, 0x64, 0x5, 0x20, 0x60, 0x80, 0x60, 0x40, 0x20, 0xC0, 0xBB, 0x1, 0x25, 0x41, 0x80, 0x5E, 0xB, 0x80, 0x80, 0x68, 0xC, 0x10, 0x10, 0xC, 0x10, 0x8, 0x2, 0x2, 0x2, 0x81, 0x62, 0x0, 0x44, 0x81, 0x73, 0x2, 0x80, 0x80, 0x60, 0xBB, 0x5C, 0x7, 0x4, 0x24, 0x49, 0x24, 0x25, 0x2, 0x22, 0x60, 0x82, 0x4B, 0x1, 0x4C, 0xC, 0x80, 0x0, 0x81, 0x5F, 0x4, 0x2, 0x2, 0x1, 0x5, 0x44, 0x82, 0x12, 0x7, 0x80, 0x80, 0x44, 0x24, 0x29, 0x2D, 0x2D, 0x29, 0xB3, 0x5C, 0x5, 0x2D, 0x51, 0x52, 0x52, 0x51, 0x29, 0x80, 0x4E, 0x1, 0x41, 0x60, 0x81, 0x0, 0x5, 0x64, 0x8, 0x8, 0xC, 0x8, 0x1, 0x82, 0x5F, 0x2, 0x2, 0x2, 0x61, 0x84, 0x5F, 0x4, 0x64, 0x2D, 0x2D, 0x4D, 0x51, 0x80, 0x25, 0xAF, 0x5E, 0x1, 0x29, 0x52, 0x81, 0x0, 0x1, 0x4E, 0x6, 0x80, 0x4C, 0x1, 0x21, 0x40, 0x81, 0x5F, 0x5, 0x44, 0x8, 0x8, 0x9, 0x5, 0x1, 0x84, 0x60, 0xA, 0x29, 0x4C, 0x4C, 0x68, 0x64, 0x64, 0x80, 0x60, 0x21, 0x6, 0x2A, 0x80, 0xC0, 0x3, 0x4D, 0x51, 0x49, 0x24, 0x80, 0x0, 0xAA, 0x5E, 0x80, 0xBC, 0x84, 0x5E, 0x80, 0xC0, 0x81, 0x60, 0x5, 0x44, 0x8, 0x2D, 0x2E, 0x2A, 0x1, 0x80, 0x0, 0x4, 0x2, 0x2, 0x1, 0xD, 0x10, 0x81, 0x0, 0x2, 0x30, 0x48, 0x41, 0x81, 0x6E, 0x0, 0x6, 0x80, 0x61, 0x4, 0x29, 0x24, 0x24, 0x49, 0x49, 0xA7, 0x60, 0x80, 0x2C, 0x82, 0x5F, 0x0, 0x2A, 0x83, 0xAD, 0xB, 0x1, 0x20, 0x40, 0x40, 0x44, 0x4D, 0x52, 0x52, 0x71, 0x69, 0x45, 0x21, 0x81, 0x61, 0x83, 0x5E, 0x3, 0x10, 0x10, 0xC, 0x5, 0x82, 0xCE, 0x3, 0x6, 0x29, 0x29, 0x4, 0x80, 0x31, 0x0, 0x49, 0xA7, 0xBD, 0x80, 0x2C, 0x4, 0x49, 0x4D, 0x4D, 0x2D, 0x29, 0x83, 0x5E, 0x80, 0x5F, 0x0, 0x24, 0x80, 0x5D, 0x9, 0x52, 0x31, 0x69, 0x80, 0x80, 0x80, 0x60, 0x1, 0x1, 0x9, 0x82, 0xBC, 0x81, 0x5F, 0x82, 0xCD, 0x3, 0x2, 0x2, 0x5, 0x4, 0x81, 0x91, 0xAC, 0x5F, 0x81, 0x0, 0x2, 0x25, 0x25, 0x25, 0x80, 0x5D, 0x3, 0x1, 0x1, 0x0, 0x2D, 0x80, 0x5E, 0x2, 0x2D, 0x9, 0x44, 0x80, 0x5F, 0x3, 0x80, 0x40, 0x4, 0xC, 0x80, 0x5A, 0x5, 0x6C, 0x84, 0x68, 0x4C, 0x10, 0x8, 0x81, 0xCC, 0x81, 0x7F, 0x82, 0x5E, 0x0, 0x24, 0xA7, 0x5F, 0x81, 0x2E, 0x86, 0x0, 0xA, 0x25, 0x25, 0x1, 0x4, 0x4D, 0x2D, 0x2D, 0x29, 0x29, 0x4, 0x24, 0x81, 0x5F, 0x1, 0x80, 0x48, 0x81, 0x5E, 0x81, 0x8, 0x1, 0x68, 0x0, 0x81, 0x5F, 0x81, 0x7E, 0x82, 0x2F, 0xA8, 0x5F, 0x86, 0xC0, 0x85, 0x0, 0x2, 0x29, 0x24, 0x4, 0x80, 0x0, 0x1, 0x20, 0x60, 0x81, 0x56, 0x0, 0x64, 0x80, 0xBF, 0x82, 0x5F, 0x1, 0x80, 0x40, 0x84, 0x60, 0x83, 0x8E, 0xA8, 0x5E, 0x8E, 0x5F, 0x83, 0x62, 0xA, 0x0, 0x40, 0x60, 0x60, 0x80, 0x60, 0x60, 0xC, 0xC, 0xC, 0x68, 0x82, 0x5F, 0x1, 0x80, 0x20, 0x81, 0x60, 0x85, 0xED, 0xA9, 0x5F, 0x84, 0x32, 0x8C, 0x0, 0x2, 0x24, 0x24, 0x24, 0x80, 0x61, 0x4, 0x40, 0x8, 0xC, 0xC, 0x48, 0x83, 0x5F, 0x2, 0x64, 0x8, 0x4, 0x86, 0x2B, 0x0, 0x24, 0xA9, 0x5F, 0x91, 0xC0, 0x84, 0x0, 0x5, 0x44, 0x44, 0x2D, 0x2D, 0x2D, 0x28, 0x84, 0x5F, 0x80, 0xCA, 0x0, 0x28, 0x85, 0x7C, 0xAA, 0x5F, 0x93, 0xC0, 0x85, 0x0, 0x2, 0x29, 0x28, 0x64, 0x81, 0x5E, 0x1, 0x60, 0x44, 0x87, 0x5E, 0x0, 0x49, 0xAA, 0x5E, 0x9C, 0x5F, 0x80, 0x0, 0x7, 0x69, 0x64, 0x64, 0x60, 0x60, 0x40, 0x8, 0x8, 0x86, 0x10, 0xAB, 0x5F, 0x0, 0x0, 0x9D, 0x5F, 0x82, 0x0, 0x0, 0x44, 0x86, 0xBD, 0x1, 0x49, 0x24, 0xAC, 0x5F, 0x9E, 0xC0, 0x8C, 0x0, 0xAC, 0x5E, 0xDE, 0x5F, 0x0, 0x0, 0xAB, 0x5E, 0x0, 0x24, 0xAE, 0x5F, 0xAB, 0xC0, 0xDD, 0x5F, 0xAE, 0x5E, 0x1, 0x0, 0x0, 0xDD, 0x5F, 0xA9, 0xC0, 0x0, 0x24, 0xFF, 0x5F, 0x8F, 0x0, 0xA8, 0x5F, 0xB1, 0x5E, 0x82, 0xC0, 0xA4, 0xC4, 0xB5, 0x5F, 0x0, 0x24, 0x80, 0x0, 0xA0, 0x5E, 0x0, 0x24, 0xB2, 0x5F, 0x80, 0x61, 0x83, 0x0, 0xD5, 0x5E, 0x85, 0x60, 0x9D, 0x5F, 0xB6, 0x5E, 0xA3, 0xC0, 0xB7, 0x5E, 0x84, 0x60, 0x0, 0x0, 0x9A, 0x60, 0x0, 0x24, 0xB9, 0x5F, 0x82, 0x60, 0x82, 0x7, 0xD3, 0x5E, 0x81, 0x60, 0x86, 0x8, 0x85, 0x51, 0x8A, 0x5F, 0xBC, 0x5E, 0x8C, 0x6B, 0x80, 0x5D, 0x82, 0x0, 0xC6, 0xBE, 0x8F, 0x62, 0x8A, 0x60, 0xCD, 0x5E, 0x8D, 0x60, 0xCE, 0x5E, 0x8B, 0x5F, 0xCF, 0xBE, 0x8A, 0x60, 0xD1, 0x5E, 0x85, 0x60, 0x81, 0x7, 0xD2, 0x5E, 0x84, 0x60, 0xD4, 0x5B, 0xFF, 0x0, 0xEF, 0x0};
+static PSImage PROGMEM title = {96, 64, BitDepth8, titleData, EncodingLZ};
+static const uint8_t PROGMEM titleTextData[112] = {0x0, 0x0, 0xDD, 0x0, 0x0, 0x92, 0x82, 0x0, 0x9C, 0x6, 0x81, 0x26, 0x8C, 0x14, 0x84, 0x3C, 0x83, 0x4, 0x98, 0x26, 0xBC, 0x5F, 0x82, 0xF, 0x85, 0x5F, 0x82, 0x2A, 0x8E, 0x26, 0x85, 0x84, 0x83, 0x1C, 0x86, 0x97, 0x92, 0xD, 0x87, 0x14, 0x88, 0xFC, 0x83, 0x17, 0x89, 0x8D, 0x87, 0x34, 0x87, 0x5F, 0x87, 0x75, 0x8F, 0xD4, 0x8E, 0xBF, 0x9A, 0x5F, 0x89, 0x42, 0xEA, 0x5F, 0x85, 0xD1, 0x88, 0xDC, 0x83, 0x58, 0x87, 0x5F, 0x86, 0x17, 0x86, 0x1C, 0x86, 0x2C, 0x83, 0x22, 0x87, 0x37, 0x85, 0x86, 0x84, 0x5F, 0x84, 0x1C, 0x95, 0xB1, 0x82, 0x14, 0x88, 0xD, 0x8D, 0x3A, 0x8F, 0x34, 0x82, 0x2D, 0x88, 0x24, 0x8B, 0x1C, 0x92, 0x5F, 0x88, 0x14, 0xA0, 0x5F, 0x8A, 0xEA, 0xD4, 0x0};
+static PSImage PROGMEM titleText = {96, 10, BitDepth8, titleTextData, EncodingLZ};
+static const uint8_t PROGMEM enterNameTextData[102] = {0x0, 0x0, 0xEA, 0x0, 0x0, 0x92, 0x82, 0x0, 0x80, 0x6, 0x81, 0xA, 0x87, 0xD, 0x89, 0x6, 0x84, 0x27, 0x8B, 0x20, 0x83, 0x12, 0x89, 0x21, 0x9C, 0x5F, 0x82, 0x34, 0x99, 0x5F, 0x8C, 0x20, 0x85, 0x3, 0x9E, 0x5F, 0x89, 0x66, 0x84, 0xF, 0x86, 0x14, 0x86, 0xA, 0x92, 0xE7, 0x84, 0xC7, 0x9A, 0x0, 0x84, 0x57, 0x8D, 0x5F, 0x8B, 0x14, 0x8A, 0xE7, 0x87, 0x6, 0x84, 0x7, 0xFC, 0x5F, 0x85, 0x6, 0x8A, 0x5F, 0x89, 0x7B, 0x89, 0x20, 0x83, 0x76, 0x82, 0x2, 0x84, 0x7, 0x9C, 0x0, 0x86, 0x88, 0x89, 0x5A, 0x87, 0x14, 0x88, 0xBF, 0x85, 0x58, 0x86, 0x57, 0x87, 0xCE, 0xB7, 0x5F, 0x86, 0xA1, 0xB5, 0x5F, 0xCF, 0x0};
+static PSImage PROGMEM enterNameText = {96, 10, BitDepth8, enterNameTextData, EncodingLZ};
+static const uint8_t PROGMEM highScoresTextData[87] = {0x0, 0x0, 0xE8, 0x0, 0x1, 0x92, 0x92, 0x82, 0x3, 0x0, 0x92, 0x80, 0x0, 0x82, 0x4, 0x82, 0x6, 0x83, 0x16, 0x83, 0x1E, 0x8B, 0x19, 0x97, 0x6, 0xFB, 0x5F, 0x89, 0x54, 0x8B, 0x5F, 0x8B, 0x85, 0x8D, 0x6, 0x87, 0x22, 0x96, 0x5F, 0x83, 0x7D, 0x87, 0xC7, 0x8A, 0x90, 0x88, 0xD2, 0x8B, 0xEC, 0x85, 0x6, 0x87, 0x41, 0xF5, 0x5F, 0x8E, 0x3, 0x85, 0xA, 0x88, 0x22, 0x8B, 0x19, 0x88, 0x92, 0x88, 0x45, 0x9A, 0x5F, 0x87, 0x90, 0x8B, 0x5F, 0x89, 0xAA, 0x89, 0x20, 0x8F, 0x14, 0xCB, 0x5F, 0x86, 0xC6, 0x9D, 0x5F, 0xD1, 0x0};
+static PSImage PROGMEM highScoresText = {96, 10, BitDepth8, highScoresTextData, EncodingLZ};
+static const uint8_t PROGMEM gameOverTextData[86] = {0x0, 0x0, 0xEE, 0x0, 0x0, 0x92, 0x82, 0x0, 0x87, 0x6, 0x82, 0x12, 0x85, 0xE, 0x8B, 0x21, 0x89, 0x19, 0x89, 0x20, 0xAA, 0x5F, 0x86, 0x3, 0xC6, 0x5F, 0x86, 0x6, 0x86, 0x36, 0x84, 0xC7, 0x88, 0x21, 0x89, 0x5F, 0x89, 0x14, 0xA2, 0x5F, 0x8B, 0xBF, 0x87, 0x7, 0x94, 0x5F, 0x82, 0x19, 0xA9, 0xBF, 0xDD, 0x5F, 0x8B, 0xFD, 0x83, 0x4, 0x88, 0x3A, 0x89, 0x58, 0x86, 0x19, 0xA5, 0x5E, 0x89, 0x36, 0x85, 0x3D, 0x87, 0x4C, 0x89, 0x21, 0x82, 0x7, 0x89, 0x2F, 0xA5, 0xBF, 0xA5, 0x5F, 0x85, 0x1C, 0x89, 0x2F, 0xED, 0x0};
+static PSImage PROGMEM gameOverText = {96, 10, BitDepth8, gameOverTextData, EncodingLZ};
+static const uint8_t PROGMEM gameOverGemsData[106] = {0x0, 0x0, 0x80, 0x0, 0x1, 0xF8, 0xF8, 0x81, 0x5, 0x80, 0x6, 0x83, 0x8, 0x85, 0x7, 0x85, 0x17, 0x81, 0x10, 0x84, 0x8, 0x83, 0x6, 0x8C, 0x0, 0x2, 0xE0, 0xE0, 0xE0, 0x84, 0x6, 0x81, 0x8, 0x82, 0x6, 0x80, 0x8, 0x8D, 0x7, 0x85, 0x1F, 0x86, 0x2F, 0x87, 0x0, 0x0, 0x7, 0x84, 0x6, 0x0, 0x7, 0x82, 0x8, 0x80, 0x6, 0x82, 0x8, 0x84, 0x7, 0x82, 0x6, 0x80, 0x8, 0x8D, 0x7, 0x86, 0x27, 0x85, 0x37, 0x86, 0x0, 0x1, 0x1C, 0x1C, 0x84, 0x6, 0x82, 0x8, 0x81, 0x6, 0x81, 0x8, 0x95, 0x7, 0x85, 0x27, 0x86, 0x37, 0x8C, 0x0, 0x0, 0x1F, 0x82, 0x0, 0x84, 0x6, 0x87, 0x0, 0x85, 0x17, 0x83, 0x20, 0x84, 0x29, 0x80, 0x4};
+static PSImage PROGMEM gameOverGems = {8, 42, BitDepth8, gameOverGemsData, EncodingLZ};
 static const uint8_t PROGMEM arrowUpData[5*3] = {0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49};
 static PSImage PROGMEM arrowUp = {5, 3, BitDepth8, arrowUpData};
 static const uint8_t PROGMEM arrowDownData[5*3] = {0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0};
 static PSImage PROGMEM arrowDown = {5, 3, BitDepth8, arrowDownData};
-static const uint8_t PROGMEM help1Data[96*64] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0xFF, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFF, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0xFF, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFF, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0xFF, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFF, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM help1 = {96, 64, BitDepth8, help1Data};
-static const uint8_t PROGMEM help2Data[96*64] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1F, 0x1F, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0x7, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM help2 = {96, 64, BitDepth8, help2Data};
-static const uint8_t PROGMEM help3Data[96*64] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0xF8, 0x0, 0xF8, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0xF8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0x0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xED, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0xEC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x92, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x92, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x0, 0x49, 0x0, 0x0, 0x49, 0x0, 0x0, 0x0, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x1C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM help3 = {96, 64, BitDepth8, help3Data};
-static const uint8_t PROGMEM creditsTextData[96*10] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM creditsText = {96, 10, BitDepth8, creditsTextData};
+static const uint8_t PROGMEM help1Data[408] = {0x0, 0x0, 0xFF, 0x0, 0x1, 0x92, 0x92, 0x82, 0x3, 0x0, 0x92, 0x82, 0x0, 0x82, 0xD, 0x82, 0x14, 0x82, 0xD, 0xFF, 0x5F, 0xA8, 0x5F, 0x86, 0xD, 0x87, 0x14, 0xC3, 0x5F, 0x84, 0xB8, 0x82, 0xB0, 0xD1, 0xBF, 0xDD, 0x5F, 0x82, 0x3, 0x86, 0x58, 0x89, 0x6, 0xCA, 0x5F, 0x87, 0xC6, 0x86, 0x6D, 0xFF, 0x5F, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xDC, 0x0, 0x0, 0x49, 0x81, 0x0, 0xFF, 0x5F, 0xF6, 0x5F, 0x9D, 0x3D, 0xBE, 0x5F, 0x82, 0x2, 0x98, 0x5B, 0x85, 0x0, 0x86, 0x2E, 0xB0, 0x5F, 0x81, 0x1, 0x80, 0x4D, 0x85, 0xCE, 0x85, 0x4D, 0x2, 0x49, 0x49, 0xFF, 0x84, 0x5C, 0x80, 0x7, 0x87, 0xED, 0x86, 0x6B, 0x82, 0x36, 0x82, 0xE, 0x84, 0x2, 0x90, 0x7D, 0x86, 0x31, 0x80, 0x2C, 0x82, 0x2, 0x88, 0x26, 0x86, 0x5E, 0x81, 0x60, 0x89, 0xEE, 0x84, 0x6C, 0x86, 0x99, 0x86, 0xA5, 0x8F, 0x60, 0x82, 0x11, 0x88, 0x55, 0x89, 0x61, 0x8F, 0xBF, 0x97, 0x5F, 0x94, 0xBE, 0x87, 0x5F, 0x83, 0xC4, 0x86, 0x4, 0x84, 0xDB, 0x87, 0x0, 0x87, 0x2F, 0x87, 0x6B, 0x86, 0x56, 0x83, 0x12, 0x92, 0x60, 0x9C, 0x0, 0x89, 0x5B, 0xD1, 0x0, 0xFF, 0x5F, 0xFF, 0x5F, 0xDD, 0x0, 0x8B, 0x9F, 0x81, 0xD, 0x0, 0x49, 0x8C, 0x13, 0xBB, 0x5C, 0x8C, 0x5F, 0x80, 0x5C, 0x99, 0x5D, 0xAB, 0x79, 0x0, 0x49, 0x82, 0x4E, 0x82, 0xB3, 0x84, 0x38, 0x81, 0xBB, 0x82, 0x1, 0x87, 0x15, 0x81, 0x4, 0x82, 0x28, 0x86, 0x16, 0xAD, 0xBF, 0x83, 0x39, 0x86, 0x9F, 0x83, 0x4A, 0x85, 0x15, 0x83, 0x11, 0x85, 0x21, 0xAB, 0x5E, 0x87, 0x5F, 0x85, 0x37, 0x8B, 0x5F, 0x85, 0x51, 0x84, 0x6D, 0xAF, 0x5F, 0x85, 0x49, 0x86, 0x60, 0x8A, 0x5F, 0x84, 0x60, 0x82, 0x8, 0x84, 0x5F, 0xAE, 0x60, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xF4, 0x0, 0x0, 0x20, 0x8C, 0x0, 0xCD, 0x5F, 0x3, 0x44, 0x44, 0x44, 0x20, 0x80, 0x3, 0x82, 0x0, 0x81, 0x8, 0xD0, 0x5F, 0x8A, 0x0, 0xFF, 0x5F, 0xFF, 0x5F, 0x98, 0x60, 0xCE, 0x5E, 0xE0, 0x5F, 0x1, 0x49, 0x49, 0x83, 0x5B, 0x81, 0x7, 0xCD, 0x5D, 0x3, 0x20, 0x20, 0x20, 0x49, 0x80, 0x0, 0x80, 0x6, 0x85, 0x7, 0xCE, 0xC0, 0x81, 0x57, 0x89, 0x7, 0xD0, 0x60, 0x8B, 0x7, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0x97, 0x0, 0x2, 0x1C, 0x1C, 0x1C, 0x95, 0x19, 0x85, 0x5, 0x96, 0x21, 0xA2, 0x5F, 0x85, 0x48, 0x8F, 0x78, 0x84, 0x1F, 0x96, 0x21, 0xA8, 0x5F, 0x82, 0xC5, 0x84, 0x4, 0x8A, 0xBF, 0x87, 0x4, 0xB5, 0x5F, 0x82, 0x54, 0x86, 0xA7, 0x80, 0x1, 0x85, 0x4D, 0x81, 0x7, 0x84, 0xB, 0xBB, 0xBF, 0x8A, 0x5F, 0x87, 0x4A, 0x83, 0x77, 0x87, 0x7, 0xB8, 0x5F, 0x84, 0xC5, 0x83, 0x4, 0x88, 0xD8, 0x85, 0x1C, 0xB7, 0x5E, 0x91, 0x6C, 0xD5, 0x0, 0xB5, 0xA7};
+static PSImage PROGMEM help1 = {96, 64, BitDepth8, help1Data, EncodingLZ};
+static const uint8_t PROGMEM help2Data[469] = {0x0, 0x0, 0xFF, 0x0, 0x1, 0x92, 0x92, 0x82, 0x3, 0x0, 0x92, 0x82, 0x0, 0x82, 0xD, 0x82, 0x14, 0x82, 0xD, 0xFF, 0x5F, 0xA8, 0x5F, 0x86, 0xD, 0x87, 0x14, 0xC3, 0x5F, 0x84, 0xB8, 0x82, 0xB0, 0xD1, 0xBF, 0xDD, 0x5F, 0x82, 0x3, 0x86, 0x58, 0x89, 0x6, 0xCA, 0x5F, 0x87, 0xC6, 0x86, 0x6D, 0xFF, 0x5F, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0x97, 0x0, 0x1, 0x49, 0x49, 0x8D, 0x10, 0xCB, 0x5E, 0xCD, 0x50, 0x90, 0x60, 0x83, 0xC4, 0x82, 0x3, 0x83, 0x1, 0x82, 0xD3, 0x81, 0x5, 0xC1, 0x7A, 0x84, 0xC1, 0x83, 0x5D, 0x84, 0x63, 0x85, 0x4, 0xC4, 0x5D, 0x87, 0x5F, 0x82, 0x8, 0xC9, 0x5F, 0x82, 0xB2, 0x83, 0xB7, 0x86, 0xC8, 0x83, 0x8, 0x0, 0x49, 0x80, 0x10, 0xC2, 0x61, 0x99, 0xDB, 0xD9, 0x5D, 0xDB, 0x5E, 0xFF, 0x0, 0xFF, 0x0, 0x99, 0x0, 0x1, 0x1C, 0x1C, 0xAA, 0x2E, 0x1, 0xF8, 0xF8, 0x8B, 0xF, 0x1, 0x49, 0x49, 0x81, 0x3, 0x81, 0x5, 0x95, 0x5E, 0x88, 0x60, 0x82, 0x26, 0x87, 0x4, 0x92, 0x5E, 0x8B, 0x60, 0x81, 0x5D, 0x81, 0x4, 0x99, 0x5E, 0x86, 0x60, 0x85, 0x2C, 0x84, 0x4, 0x9E, 0x5F, 0x83, 0x22, 0x80, 0x2D, 0x9B, 0xBE, 0x83, 0x5F, 0x86, 0x2C, 0x81, 0xBB, 0x82, 0x4, 0x94, 0x60, 0x88, 0xED, 0x81, 0x86, 0x85, 0x37, 0x9C, 0x5F, 0x86, 0x2C, 0x85, 0x5D, 0x96, 0x5F, 0x8A, 0xBF, 0x82, 0x25, 0x96, 0xED, 0x8C, 0xBF, 0x87, 0x2C, 0x98, 0x31, 0x87, 0x5E, 0x84, 0xC3, 0x87, 0xC4, 0x95, 0x60, 0x90, 0x2C, 0x98, 0x31, 0xAC, 0x0, 0x87, 0x5E, 0xFF, 0x0, 0x4, 0x0, 0x0, 0xE0, 0xE0, 0xE0, 0xDC, 0x5E, 0x8B, 0x60, 0x0, 0x49, 0x80, 0x0, 0x81, 0x5, 0x95, 0x30, 0x0, 0x1F, 0x82, 0x0, 0x8F, 0x2C, 0x93, 0x31, 0x82, 0x5E, 0x8A, 0x60, 0x82, 0x26, 0x81, 0x34, 0x99, 0x5E, 0x85, 0x60, 0x87, 0x2C, 0x94, 0x31, 0x8C, 0x5F, 0x82, 0x8C, 0x83, 0x2F, 0x9F, 0x5F, 0x8A, 0x2C, 0x94, 0x31, 0x8B, 0x5F, 0x82, 0x2E, 0x86, 0x30, 0x99, 0x60, 0x8E, 0x2C, 0x95, 0x31, 0x8A, 0xBE, 0x84, 0xE5, 0x96, 0xED, 0x86, 0x60, 0x8F, 0x2C, 0x96, 0x31, 0x89, 0x5E, 0x84, 0xC4, 0x85, 0x4, 0x96, 0x60, 0x91, 0x2C, 0x99, 0x31, 0xDA, 0x0, 0x0, 0x7, 0xDC, 0x5E, 0x0, 0x7, 0xDA, 0x60, 0x80, 0x5E, 0x88, 0x60, 0x0, 0x49, 0x81, 0x3, 0x86, 0x4, 0xCE, 0x5F, 0x81, 0x55, 0x82, 0x2, 0x83, 0x7, 0xC5, 0x5E, 0x83, 0x60, 0x82, 0xB6, 0x82, 0x5C, 0x81, 0x5F, 0xC4, 0xC0, 0x87, 0x5F, 0x0, 0x49, 0x85, 0xBC, 0x84, 0x5D, 0xD7, 0xBF, 0x81, 0x5F, 0x83, 0xE, 0xC5, 0x60, 0x85, 0xC, 0x83, 0xC3, 0x82, 0x68, 0xC4, 0x5E, 0x82, 0x60, 0xC5, 0x4A, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xE0, 0x0, 0x2, 0x1C, 0x1C, 0x1C, 0x95, 0x18, 0x83, 0x6, 0x86, 0x9, 0xB4, 0x5F, 0x82, 0x2, 0x97, 0x17, 0x0, 0x1C, 0x96, 0x21, 0xA9, 0x5F, 0x82, 0xC5, 0x84, 0x4, 0x89, 0x1A, 0x85, 0x63, 0xB8, 0x5F, 0x82, 0x54, 0x86, 0xA7, 0x80, 0x1, 0x84, 0x4D, 0x82, 0x7, 0x85, 0xB, 0xBA, 0xBF, 0x8A, 0x5F, 0x85, 0x4A, 0x87, 0xB8, 0x83, 0x7F, 0xBA, 0x5F, 0x84, 0xC5, 0x83, 0x4, 0x86, 0xD7, 0x82, 0x72, 0x85, 0xC9, 0xC2, 0x0, 0xC6, 0x48, 0x93, 0x5D, 0xB4, 0x5E};
+static PSImage PROGMEM help2 = {96, 64, BitDepth8, help2Data, EncodingLZ};
+static const uint8_t PROGMEM help3Data[600] = {0x0, 0x0, 0xFF, 0x0, 0x1, 0x92, 0x92, 0x82, 0x3, 0x0, 0x92, 0x82, 0x0, 0x82, 0xD, 0x82, 0x14, 0x82, 0xD, 0xFF, 0x5F, 0xA8, 0x5F, 0x86, 0xD, 0x87, 0x14, 0xC3, 0x5F, 0x84, 0xB8, 0x82, 0xB0, 0xD1, 0xBF, 0xDD, 0x5F, 0x82, 0x3, 0x86, 0x58, 0x89, 0x6, 0xCA, 0x5F, 0x87, 0xC6, 0x86, 0x6D, 0xFF, 0x5F, 0xFF, 0x0, 0xFF, 0x0, 0x9F, 0x0, 0x0, 0xF8, 0x85, 0x8, 0x0, 0x49, 0xBF, 0x4B, 0x91, 0x42, 0x86, 0x5F, 0xC0, 0x0, 0x8E, 0x5F, 0x0, 0xF8, 0x83, 0x0, 0x84, 0x1C, 0x1, 0x49, 0x49, 0x81, 0x20, 0x80, 0x4, 0x81, 0x1, 0x81, 0x7, 0x81, 0x4, 0x82, 0x9, 0x8A, 0xE, 0x82, 0x2C, 0x81, 0x25, 0x85, 0x2E, 0x8D, 0x1C, 0x8D, 0x60, 0x85, 0x7C, 0x81, 0x45, 0x82, 0x83, 0x82, 0x4F, 0x83, 0x68, 0x83, 0x7, 0x85, 0xE, 0x85, 0x40, 0x84, 0x12, 0x82, 0x2E, 0x83, 0x8F, 0x84, 0x2B, 0x91, 0x60, 0x86, 0xDC, 0x87, 0x5F, 0x8A, 0x42, 0x83, 0xD2, 0x83, 0x3B, 0x89, 0x61, 0x88, 0x7C, 0x88, 0x2B, 0x8D, 0x5E, 0x81, 0x2, 0x89, 0x5F, 0x84, 0x39, 0x88, 0xF3, 0x83, 0xF7, 0x82, 0xD3, 0x85, 0x5E, 0x82, 0x8, 0x87, 0x17, 0x87, 0x2B, 0x8E, 0x5F, 0x84, 0x3, 0xB1, 0x0, 0x8F, 0x4D, 0xCB, 0x0, 0xA2, 0x5F, 0x90, 0xD3, 0xCA, 0x83, 0x81, 0x0, 0xC8, 0xF0, 0x8D, 0x42, 0x82, 0x5F, 0x85, 0x14, 0xCF, 0x5F, 0x83, 0x5E, 0x83, 0x14, 0x82, 0x7, 0x82, 0xB, 0x80, 0x4, 0x81, 0x1, 0x85, 0xC, 0x82, 0x9, 0x8A, 0xE, 0x85, 0x2E, 0x83, 0xC, 0x89, 0x4, 0x8B, 0x5F, 0x84, 0x5E, 0x82, 0x14, 0x81, 0x40, 0x81, 0x1, 0x82, 0x59, 0x82, 0x2E, 0x85, 0xC, 0x82, 0x7, 0x85, 0xE, 0x86, 0xEB, 0x83, 0x12, 0x87, 0x33, 0x85, 0x2B, 0x9B, 0x5F, 0x84, 0x35, 0x86, 0x63, 0x85, 0x33, 0x87, 0x5A, 0x89, 0x61, 0x88, 0x33, 0x88, 0x2B, 0x8E, 0x5F, 0x87, 0xF0, 0x86, 0x2C, 0x83, 0x72, 0x85, 0xF3, 0x83, 0x23, 0x83, 0x1F, 0x8B, 0x2D, 0x87, 0x5B, 0x85, 0x2B, 0x8F, 0x60, 0x8B, 0x12, 0xA9, 0x0, 0xB8, 0x3A, 0xFF, 0x5F, 0xA2, 0x0, 0x1, 0xE0, 0xE0, 0x81, 0x2, 0x9E, 0x8B, 0x80, 0x1C, 0x81, 0x1F, 0x89, 0x23, 0x92, 0x2F, 0x0, 0x49, 0x80, 0x0, 0x89, 0x19, 0x2, 0xE0, 0xED, 0xE0, 0x81, 0x0, 0xA1, 0x5F, 0xA1, 0x5E, 0x8E, 0x27, 0x82, 0x5D, 0x84, 0x5F, 0x80, 0x79, 0x81, 0x5, 0x84, 0x9, 0x84, 0x2, 0x82, 0x14, 0x84, 0xD, 0x83, 0x17, 0x84, 0x3C, 0x83, 0xA, 0x83, 0x32, 0x81, 0x7, 0x84, 0x27, 0x83, 0x44, 0x88, 0xC0, 0x85, 0x5E, 0x84, 0x42, 0x8C, 0x4, 0x85, 0x29, 0x87, 0x70, 0x85, 0x13, 0x84, 0x24, 0x84, 0x28, 0x88, 0x52, 0x8A, 0xC, 0x82, 0x60, 0x88, 0x17, 0x8C, 0x4, 0x86, 0xAE, 0x88, 0xD0, 0x89, 0x46, 0x86, 0x5F, 0x86, 0xBF, 0x8E, 0x5F, 0x0, 0x0, 0x84, 0x5E, 0x85, 0xDA, 0x88, 0x49, 0x81, 0xAB, 0x87, 0x4E, 0x8B, 0x70, 0x89, 0x5D, 0x81, 0x28, 0x85, 0x53, 0x84, 0x3F, 0xE9, 0x0, 0x1, 0x92, 0xEC, 0xDB, 0x5E, 0xDB, 0xBD, 0x2, 0x49, 0x49, 0x49, 0x84, 0x8, 0x9C, 0x27, 0x83, 0x21, 0x9C, 0x25, 0x8F, 0x36, 0x0, 0x92, 0x85, 0x60, 0x9F, 0x5F, 0xB5, 0x5E, 0x83, 0x60, 0x82, 0x9D, 0x83, 0x4, 0x81, 0xAB, 0x85, 0x49, 0x88, 0x7E, 0x0, 0x49, 0x8C, 0x1A, 0xA1, 0x5F, 0x83, 0x0, 0x86, 0x40, 0x82, 0x43, 0x82, 0xC, 0x89, 0x56, 0x89, 0x1E, 0x87, 0x1A, 0xB4, 0x5F, 0x82, 0xA0, 0x87, 0xBE, 0x8F, 0x5F, 0xA8, 0xBE, 0x84, 0x60, 0x87, 0x4A, 0x82, 0x3, 0x84, 0x63, 0x86, 0x20, 0x85, 0x1E, 0x87, 0x7E, 0xAB, 0x60, 0xA9, 0x2E, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xF7, 0x0, 0x2, 0x1C, 0x1C, 0x1C, 0x95, 0x18, 0x83, 0x6, 0x86, 0x9, 0xB4, 0x5F, 0x82, 0x2, 0x97, 0x17, 0x0, 0x1C, 0x96, 0x21, 0xA9, 0x5F, 0x82, 0xC5, 0x84, 0x4, 0x88, 0x19, 0x89, 0x4, 0xB5, 0x5F, 0x82, 0x54, 0x86, 0xA7, 0x80, 0x1, 0x89, 0x60, 0x84, 0xB, 0xBB, 0xBF, 0x8A, 0x5F, 0x85, 0x4A, 0x85, 0x12, 0x89, 0x66, 0xB6, 0x5F, 0x84, 0xC5, 0x83, 0x4, 0x86, 0xD8, 0x87, 0x1C, 0xB7, 0x5E, 0x91, 0x6C, 0xD5, 0x0, 0xB5, 0xA7};
+static PSImage PROGMEM help3 = {96, 64, BitDepth8, help3Data, EncodingLZ};
+static const uint8_t PROGMEM creditsTextData[72] = {0x0, 0x0, 0xF4, 0x0, 0x0, 0x92, 0x82, 0x0, 0x93, 0x6, 0x82, 0x7, 0x8D, 0x13, 0xC7, 0x5F, 0x83, 0x7, 0xBE, 0x5F, 0x82, 0x3, 0x88, 0x6, 0x88, 0x15, 0x84, 0xF, 0x82, 0x5, 0xB0, 0x5B, 0x86, 0x3B, 0x8B, 0xC6, 0x95, 0x5F, 0xB6, 0xBF, 0xDD, 0x5F, 0x87, 0x58, 0x85, 0x40, 0x90, 0x5F, 0x8A, 0x8, 0xA9, 0x5F, 0x84, 0xB8, 0x81, 0x9, 0x8A, 0xC6, 0x84, 0x7, 0xBE, 0xBF, 0x85, 0x5F, 0x86, 0xC6, 0x86, 0x6, 0xC1, 0x5F, 0xC5, 0x0};
+static PSImage PROGMEM creditsText = {96, 10, BitDepth8, creditsTextData, EncodingLZ};
 
 // the ingame minecart image
 // converter settings: convert to code, 8 bit, 1-dimensional, with alpha
-static const uint8_t PROGMEM cartData[18*11] = {0xFD, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0xFD, 0xFD, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD};
-static PSImage PROGMEM cart = {18, 11, BitDepth8, cartData};
+static const uint8_t PROGMEM cartData[211] = {0x16, 0x0, 0x29, 0x0, 0x3C, 0x0, 0x4F, 0x0, 0x62, 0x0, 0x75, 0x0, 0x86, 0x0, 0x97, 0x0, 0xA8, 0x0, 0xBD, 0x0, 0xCA, 0x0, 0x1, 0x1, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1, 0x1, 0x10, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x1, 0x1, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1, 0x1, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1, 0x1, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1, 0x2, 0xE, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1, 0x2, 0xE, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x1, 0x2, 0xE, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x1, 0x0, 0x12, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x2, 0x3, 0x4, 0x49, 0x49, 0x49, 0x49, 0xB, 0x4, 0x49, 0x49, 0x49, 0x49, 0x2, 0x4, 0x2, 0x49, 0x49, 0xC, 0x2, 0x49, 0x49};
+static PSImage PROGMEM cart = {18, 11, BitDepth8, cartData, EncodingSpans};
 
 // the object images
 // converter settings as above
-static const uint8_t PROGMEM nuggetData[4*6] = {0xFD, 0xF0, 0xF0, 0xFD, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xFD, 0xF0, 0xF0, 0xFD, 0xFD, 0xF0, 0xF0, 0xF0, 0xFD, 0xFD, 0xF0, 0xFD};
-static PSImage PROGMEM nugget = {4, 6, BitDepth8, nuggetData};
-static const uint8_t PROGMEM rubyData[7*7] = {0xFD, 0xFD, 0xE0, 0xE0, 0xE0, 0xFD, 0xFD, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFD, 0xFD, 0xE0, 0xE0, 0xE0, 0xFD, 0xFD};
-static PSImage PROGMEM ruby = {7, 7, BitDepth8, rubyData};
-static const uint8_t PROGMEM sapphireData[7*9] = {0xFD, 0xFD, 0xFD, 0x7, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x7, 0x7, 0x7, 0xFD, 0xFD, 0xFD, 0x7, 0x7, 0x7, 0x7, 0x7, 0xFD, 0xFD, 0x7, 0x7, 0x7, 0x7, 0x7, 0xFD, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0xFD, 0x7, 0x7, 0x7, 0x7, 0x7, 0xFD, 0xFD, 0xFD, 0x7, 0x7, 0x7, 0xFD, 0xFD};
-static PSImage PROGMEM sapphire = {7, 9, BitDepth8, sapphireData};
-static const uint8_t PROGMEM emeraldData[6*8] = {0xFD, 0xFD, 0x1C, 0x1C, 0xFD, 0xFD, 0xFD, 0x1C, 0x1C, 0x1C, 0x1C, 0xFD, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFD, 0x1C, 0x1C, 0x1C, 0x1C, 0xFD, 0xFD, 0xFD, 0x1C, 0x1C, 0xFD, 0xFD};
-static PSImage PROGMEM emerald = {6, 8, BitDepth8, emeraldData};
-static const uint8_t PROGMEM diamondData[8*6] = {0xFD, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFD, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFD, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0xFD, 0xFD, 0xFD, 0x1F, 0x1F, 0x1F, 0x1F, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x1F, 0x1F, 0xFD, 0xFD, 0xFD};
-static PSImage PROGMEM diamond = {8, 6, BitDepth8, diamondData};
-static const uint8_t PROGMEM starData[7*7] = {0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFD, 0xFD, 0xFF, 0xFD, 0xFD, 0xFD, 0xFF, 0xFD};
-static PSImage PROGMEM star = {7, 7, BitDepth8, starData};
-static const uint8_t PROGMEM star2Data[7*7] = {0xFD, 0xFD, 0xFD, 0xF8, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF8, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFD, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8, 0xF8, 0xFD, 0xFD, 0xFD, 0xF8, 0xF8, 0xFD, 0xF8, 0xF8, 0xFD, 0xFD, 0xF8, 0xFD, 0xFD, 0xFD, 0xF8, 0xFD};
-static PSImage PROGMEM star2 = {7, 7, BitDepth8, star2Data};
-static const uint8_t PROGMEM heartData[7*6] = {0xFD, 0xE0, 0xE0, 0xFD, 0xE0, 0xE0, 0xFD, 0xE0, 0xF2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFD, 0xFD, 0xFD, 0xE0, 0xE0, 0xE0, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xE0, 0xFD, 0xFD, 0xFD};
-static PSImage PROGMEM heart = {7, 6, BitDepth8, heartData};
-static const uint8_t PROGMEM heart2Data[7*6] = {0xFD, 0xF2, 0xF2, 0xFD, 0xF2, 0xF2, 0xFD, 0xF2, 0xFF, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xFD, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xFD, 0xFD, 0xFD, 0xF2, 0xF2, 0xF2, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xF2, 0xFD, 0xFD, 0xFD};
-static PSImage PROGMEM heart2 = {7, 6, BitDepth8, heart2Data};
-static const uint8_t PROGMEM stoneData[8*8] = {0xFD, 0xFD, 0xFD, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD};
-static PSImage PROGMEM stone = {8, 8, BitDepth8, stoneData};
-static const uint8_t PROGMEM bombData[7*9] = {0xFD, 0xFD, 0xFD, 0xFD, 0x92, 0xEC, 0xFD, 0xFD, 0xFD, 0xFD, 0x92, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0x49, 0x92, 0x49, 0x49, 0x49, 0xFD, 0x49, 0x92, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0x49, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0xFD, 0xFD};
-static PSImage PROGMEM bomb = {7, 9, BitDepth8, bombData};
+static const uint8_t PROGMEM nuggetData[46] = {0xC, 0x0, 0x11, 0x0, 0x18, 0x0, 0x1F, 0x0, 0x24, 0x0, 0x2A, 0x0, 0x1, 0x1, 0x2, 0xF0, 0xF0, 0x1, 0x0, 0x4, 0xF0, 0xF0, 0xF0, 0xF0, 0x1, 0x0, 0x4, 0xF0, 0xF0, 0xF0, 0xF0, 0x1, 0x1, 0x2, 0xF0, 0xF0, 0x1, 0x1, 0x3, 0xF0, 0xF0, 0xF0, 0x1, 0x2, 0x1, 0xF0};
+static PSImage PROGMEM nugget = {4, 6, BitDepth8, nuggetData, EncodingSpans};
+static const uint8_t PROGMEM rubyData[72] = {0xE, 0x0, 0x14, 0x0, 0x1C, 0x0, 0x26, 0x0, 0x30, 0x0, 0x3A, 0x0, 0x42, 0x0, 0x1, 0x2, 0x3, 0xE0, 0xE0, 0xE0, 0x1, 0x1, 0x5, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1, 0x0, 0x7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1, 0x0, 0x7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1, 0x0, 0x7, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1, 0x1, 0x5, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1, 0x2, 0x3, 0xE0, 0xE0, 0xE0};
+static PSImage PROGMEM ruby = {7, 7, BitDepth8, rubyData, EncodingSpans};
+static const uint8_t PROGMEM sapphireData[88] = {0x12, 0x0, 0x16, 0x0, 0x1C, 0x0, 0x24, 0x0, 0x2C, 0x0, 0x36, 0x0, 0x40, 0x0, 0x4A, 0x0, 0x52, 0x0, 0x1, 0x3, 0x1, 0x7, 0x1, 0x2, 0x3, 0x7, 0x7, 0x7, 0x1, 0x1, 0x5, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x1, 0x5, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x0, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x1, 0x5, 0x7, 0x7, 0x7, 0x7, 0x7, 0x1, 0x2, 0x3, 0x7, 0x7, 0x7};
+static PSImage PROGMEM sapphire = {7, 9, BitDepth8, sapphireData, EncodingSpans};
+static const uint8_t PROGMEM emeraldData[76] = {0x10, 0x0, 0x15, 0x0, 0x1C, 0x0, 0x25, 0x0, 0x2E, 0x0, 0x37, 0x0, 0x40, 0x0, 0x47, 0x0, 0x1, 0x2, 0x2, 0x1C, 0x1C, 0x1, 0x1, 0x4, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x0, 0x6, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x0, 0x6, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x0, 0x6, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x0, 0x6, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x1, 0x4, 0x1C, 0x1C, 0x1C, 0x1C, 0x1, 0x2, 0x2, 0x1C, 0x1C};
+static PSImage PROGMEM emerald = {6, 8, BitDepth8, emeraldData, EncodingSpans};
+static const uint8_t PROGMEM diamondData[64] = {0xC, 0x0, 0x15, 0x0, 0x20, 0x0, 0x2B, 0x0, 0x34, 0x0, 0x3B, 0x0, 0x1, 0x1, 0x6, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1, 0x0, 0x8, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1, 0x0, 0x8, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1, 0x1, 0x6, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1, 0x2, 0x4, 0x1F, 0x1F, 0x1F, 0x1F, 0x1, 0x3, 0x2, 0x1F, 0x1F};
+static PSImage PROGMEM diamond = {8, 6, BitDepth8, diamondData, EncodingSpans};
+static const uint8_t PROGMEM starsData[101] = {0xE, 0x0, 0x15, 0x0, 0x1C, 0x0, 0x2D, 0x0, 0x3C, 0x0, 0x47, 0x0, 0x58, 0x0, 0x2, 0x3, 0x1, 0xFF, 0xA, 0x1, 0xF8, 0x2, 0x3, 0x1, 0xFF, 0xA, 0x1, 0xF8, 0x1, 0x0, 0xE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x2, 0x1, 0x5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8, 0x5, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0x2, 0x2, 0x3, 0xFF, 0xFF, 0xFF, 0x9, 0x3, 0xF8, 0xF8, 0xF8, 0x4, 0x1, 0x2, 0xFF, 0xFF, 0x4, 0x2, 0xFF, 0xFF, 0x8, 0x2, 0xF8, 0xF8, 0xB, 0x2, 0xF8, 0xF8, 0x4, 0x1, 0x1, 0xFF, 0x5, 0x1, 0xFF, 0x8, 0x1, 0xF8, 0xC, 0x1, 0xF8};
+static PSImage PROGMEM stars = {14, 7, BitDepth8, starsData, EncodingSpans};
+static const PSFrame starFrames[2] = {{0, 0, 7, 7}, {7, 0, 7, 7}};
+static const PSAtlas starAtlas = {&stars, starFrames, 2};
+static const uint8_t PROGMEM heartsData[96] = {0xC, 0x0, 0x1D, 0x0, 0x2E, 0x0, 0x3F, 0x0, 0x4E, 0x0, 0x59, 0x0, 0x4, 0x1, 0x2, 0xE0, 0xE0, 0x4, 0x2, 0xE0, 0xE0, 0x8, 0x2, 0xF2, 0xF2, 0xB, 0x2, 0xF2, 0xF2, 0x1, 0x0, 0xE, 0xE0, 0xF2, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF2, 0xFF, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x1, 0x0, 0xE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x2, 0x1, 0x5, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x8, 0x5, 0xF2, 0xF2, 0xF2, 0xF2, 0xF2, 0x2, 0x2, 0x3, 0xE0, 0xE0, 0xE0, 0x9, 0x3, 0xF2, 0xF2, 0xF2, 0x2, 0x3, 0x1, 0xE0, 0xA, 0x1, 0xF2};
+static PSImage PROGMEM hearts = {14, 6, BitDepth8, heartsData, EncodingSpans};
+static const PSFrame heartFrames[2] = {{0, 0, 7, 6}, {7, 0, 7, 6}};
+static const PSAtlas heartAtlas = {&hearts, heartFrames, 2};
+static const uint8_t PROGMEM stoneData[88] = {0x10, 0x0, 0x15, 0x0, 0x1D, 0x0, 0x26, 0x0, 0x30, 0x0, 0x3B, 0x0, 0x46, 0x0, 0x50, 0x0, 0x1, 0x3, 0x2, 0x49, 0x49, 0x1, 0x2, 0x5, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x2, 0x6, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x1, 0x7, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x0, 0x8, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x0, 0x8, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x0, 0x7, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x1, 0x5, 0x49, 0x49, 0x49, 0x49, 0x49};
+static PSImage PROGMEM stone = {8, 8, BitDepth8, stoneData, EncodingSpans};
+static const uint8_t PROGMEM bombData[85] = {0x12, 0x0, 0x17, 0x0, 0x1B, 0x0, 0x21, 0x0, 0x29, 0x0, 0x33, 0x0, 0x3D, 0x0, 0x47, 0x0, 0x4F, 0x0, 0x1, 0x4, 0x2, 0x92, 0xEC, 0x1, 0x3, 0x1, 0x92, 0x1, 0x2, 0x3, 0x49, 0x49, 0x49, 0x1, 0x1, 0x5, 0x49, 0x92, 0x49, 0x49, 0x49, 0x1, 0x0, 0x7, 0x49, 0x92, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x0, 0x7, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x0, 0x7, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x1, 0x5, 0x49, 0x49, 0x49, 0x49, 0x49, 0x1, 0x2, 0x3, 0x49, 0x49, 0x49};
+static PSImage PROGMEM bomb = {7, 9, BitDepth8, bombData, EncodingSpans};
 
 // the minecart sprite. the image and y location are set here since they never change. also 'enabled' is set to true since
 // it's always visible anyway
@@ -5,8 +5,8 @@
  */
 
 // title screen image, with the minecart image and the 'treasure miner' text
-static const uint8_t PROGMEM titleData[96*64] = {0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x92, 0x92, 0x92, 0x92, 0x92, 0x92, 0x0, 0x92, 0x92, 0x0, 0x0, 0x92, 0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xC, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x28, 0x28, 0xC, 0x10, 0x10, 0x10, 0xC, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x64, 0x48, 0x2C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x29, 0x64, 0x80, 0x80, 0x80, 0x84, 0x4C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x28, 0x25, 0x25, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x20, 0x60, 0x80, 0x60, 0x40, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x25, 0x41, 0x80, 0x80, 0x80, 0x80, 0x80, 0x68, 0xC, 0x10, 0x10, 0xC, 0x10, 0x8, 0x2, 0x2, 0x2, 0x25, 0x25, 0x24, 0x24, 0x44, 0x64, 0x80, 0x80, 0x80, 0x80, 0x80, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x24, 0x49, 0x24, 0x25, 0x2, 0x22, 0x60, 0x80, 0x80, 0x80, 0x80, 0x80, 0x4C, 0xC, 0xC, 0xC, 0xC, 0x8, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x5, 0x44, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x44, 0x24, 0x29, 0x2D, 0x2D, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x2D, 0x51, 0x52, 0x52, 0x51, 0x29, 0x2, 0x2, 0x2, 0x41, 0x60, 0x60, 0x60, 0x60, 0x60, 0x64, 0x8, 0x8, 0xC, 0x8, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x61, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0x2D, 0x2D, 0x4D, 0x51, 0x52, 0x51, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x52, 0x52, 0x52, 0x52, 0x52, 0x4E, 0x6, 0x2, 0x2, 0x2, 0x21, 0x40, 0x60, 0x60, 0x60, 0x60, 0x44, 0x8, 0x8, 0x9, 0x5, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x29, 0x4C, 0x4C, 0x68, 0x64, 0x64, 0x80, 0x60, 0x21, 0x6, 0x2A, 0x29, 0x2D, 0x2D, 0x4D, 0x51, 0x49, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x29, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4E, 0x6, 0x2, 0x2, 0x2, 0x2, 0x2, 0x41, 0x40, 0x60, 0x60, 0x60, 0x44, 0x8, 0x2D, 0x2E, 0x2A, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x1, 0xD, 0x10, 0x10, 0x10, 0x10, 0x10, 0x30, 0x48, 0x41, 0x1, 0x2, 0x2, 0x2, 0x6, 0x29, 0x2D, 0x2D, 0x29, 0x24, 0x24, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x51, 0x52, 0x52, 0x52, 0x52, 0x2A, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x20, 0x40, 0x40, 0x44, 0x4D, 0x52, 0x52, 0x71, 0x69, 0x45, 0x21, 0x1, 0x1, 0x1, 0x1, 0xD, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xC, 0x5, 0x1, 0x2, 0x2, 0x2, 0x2, 0x6, 0x29, 0x29, 0x4, 0x24, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x4D, 0x4D, 0x2D, 0x29, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x1, 0x20, 0x24, 0x4D, 0x52, 0x52, 0x52, 0x31, 0x69, 0x80, 0x80, 0x80, 0x60, 0x1, 0x1, 0x9, 0x10, 0x10, 0x10, 0x10, 0x30, 0x10, 0x10, 0x10, 0xC, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x2, 0x5, 0x4, 0x0, 0x24, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x25, 0x2, 0x2, 0x1, 0x1, 0x1, 0x0, 0x2D, 0x52, 0x52, 0x52, 0x2D, 0x9, 0x44, 0x80, 0x80, 0x80, 0x80, 0x40, 0x4, 0xC, 0x10, 0x10, 0x10, 0x6C, 0x84, 0x68, 0x4C, 0x10, 0x8, 0x1, 0x1, 0x1, 0x1, 0x2, 0x2, 0x2, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x25, 0x25, 0x1, 0x4, 0x4D, 0x2D, 0x2D, 0x29, 0x29, 0x4, 0x24, 0x80, 0x80, 0x80, 0x80, 0x80, 0x48, 0x10, 0x10, 0x10, 0x6C, 0x80, 0x80, 0x80, 0x80, 0x68, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x24, 0x4, 0x4, 0x4, 0x4, 0x20, 0x60, 0x80, 0x80, 0x80, 0x80, 0x64, 0xC, 0x10, 0x10, 0x6C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x24, 0x4, 0x0, 0x40, 0x60, 0x60, 0x80, 0x60, 0x60, 0xC, 0xC, 0xC, 0x68, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x20, 0x0, 0x1, 0x1, 0x1, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x24, 0x24, 0x40, 0x60, 0x60, 0x40, 0x8, 0xC, 0xC, 0x48, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0x8, 0x4, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x44, 0x2D, 0x2D, 0x2D, 0x28, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0xC, 0xC, 0xC, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x29, 0x28, 0x64, 0x80, 0x80, 0x80, 0x80, 0x60, 0x44, 0xC, 0xC, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x69, 0x64, 0x64, 0x60, 0x60, 0x40, 0x8, 0x8, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x44, 0x28, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x49, 0x49, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x49, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x49, 0x49, 0x49, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x24, 0x24, 0x24, 0x24, 0x24, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
-static PSImage PROGMEM title = {96, 64, BitDepth8, titleData};
+static const uint8_t PROGMEM titleData[839] = {0x0, 0x0, 0xDD, 0x0, 0x0, 0x92, 0x82, 0x0, 0x9C, 0x6, 0x81, 0x26, 0x8C, 0x14, 0x84, 0x3C, 0x83, 0x4, 0x98, 0x26, 0xBC, 0x5F, 0x82, 0xF, 0x85, 0x5F, 0x82, 0x2A, 0x8E, 0x26, 0x85, 0x84, 0x83, 0x1C, 0x86, 0x97, 0x92, 0xD, 0x87, 0x14, 0x88, 0xFC, 0x83, 0x17, 0x89, 0x8D, 0x87, 0x34, 0x87, 0x5F, 0x87, 0x75, 0x8F, 0xD4, 0x8E, 0xBF, 0x9A, 0x5F, 0x89, 0x42, 0xEA, 0x5F, 0x85, 0xD1, 0x88, 0xDC, 0x83, 0x58, 0x87, 0x5F, 0x86, 0x17, 0x86, 0x1C, 0x86, 0x2C, 0x83, 0x22, 0x87, 0x37, 0x85, 0x86, 0x84, 0x5F, 0x84, 0x1C, 0x95, 0xB1, 0x82, 0x14, 0x88, 0xD, 0x8D, 0x3A, 0x8F, 0x34, 0x82, 0x2D, 0x88, 0x24, 0x8B, 0x1C, 0x92, 0x5F, 0x88, 0x14, 0xA0, 0x5F, 0x8A, 0xEA, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0xFF, 0x0, 0x8E, 0x0, 0x2, 0x4, 0xC, 0x8, 0xD5, 0x5A, 0x8, 0x24, 0x49, 0x28, 0x28, 0xC, 0x10, 0x10, 0x10, 0xC, 0xD4, 0x5D, 0x2, 0x64, 0x48, 0x2C, 0x80, 0x5D, 0x80, 0x0, 0x2, 0x24, 0x24, 0x24, 0xCE, 0x5D, 0x6, 0x29, 0x64, 0x80, 0x80, 0x80, 0x84, 0x4C, 0x82, 0x5F, 0x2, 0x28, 0x25, 0x25, 0x80, 0x62, 0x81, 0x64, 0x5, 0x20, 0x60, 0x80, 0x60, 0x40, 0x20, 0xC0, 0xBB, 0x1, 0x25, 0x41, 0x80, 0x5E, 0xB, 0x80, 0x80, 0x68, 0xC, 0x10, 0x10, 0xC, 0x10, 0x8, 0x2, 0x2, 0x2, 0x81, 0x62, 0x0, 0x44, 0x81, 0x73, 0x2, 0x80, 0x80, 0x60, 0xBB, 0x5C, 0x7, 0x4, 0x24, 0x49, 0x24, 0x25, 0x2, 0x22, 0x60, 0x82, 0x4B, 0x1, 0x4C, 0xC, 0x80, 0x0, 0x81, 0x5F, 0x4, 0x2, 0x2, 0x1, 0x5, 0x44, 0x82, 0x12, 0x7, 0x80, 0x80, 0x44, 0x24, 0x29, 0x2D, 0x2D, 0x29, 0xB3, 0x5C, 0x5, 0x2D, 0x51, 0x52, 0x52, 0x51, 0x29, 0x80, 0x4E, 0x1, 0x41, 0x60, 0x81, 0x0, 0x5, 0x64, 0x8, 0x8, 0xC, 0x8, 0x1, 0x82, 0x5F, 0x2, 0x2, 0x2, 0x61, 0x84, 0x5F, 0x4, 0x64, 0x2D, 0x2D, 0x4D, 0x51, 0x80, 0x25, 0xAF, 0x5E, 0x1, 0x29, 0x52, 0x81, 0x0, 0x1, 0x4E, 0x6, 0x80, 0x4C, 0x1, 0x21, 0x40, 0x81, 0x5F, 0x5, 0x44, 0x8, 0x8, 0x9, 0x5, 0x1, 0x84, 0x60, 0xA, 0x29, 0x4C, 0x4C, 0x68, 0x64, 0x64, 0x80, 0x60, 0x21, 0x6, 0x2A, 0x80, 0xC0, 0x3, 0x4D, 0x51, 0x49, 0x24, 0x80, 0x0, 0xAA, 0x5E, 0x80, 0xBC, 0x84, 0x5E, 0x80, 0xC0, 0x81, 0x60, 0x5, 0x44, 0x8, 0x2D, 0x2E, 0x2A, 0x1, 0x80, 0x0, 0x4, 0x2, 0x2, 0x1, 0xD, 0x10, 0x81, 0x0, 0x2, 0x30, 0x48, 0x41, 0x81, 0x6E, 0x0, 0x6, 0x80, 0x61, 0x4, 0x29, 0x24, 0x24, 0x49, 0x49, 0xA7, 0x60, 0x80, 0x2C, 0x82, 0x5F, 0x0, 0x2A, 0x83, 0xAD, 0xB, 0x1, 0x20, 0x40, 0x40, 0x44, 0x4D, 0x52, 0x52, 0x71, 0x69, 0x45, 0x21, 0x81, 0x61, 0x83, 0x5E, 0x3, 0x10, 0x10, 0xC, 0x5, 0x82, 0xCE, 0x3, 0x6, 0x29, 0x29, 0x4, 0x80, 0x31, 0x0, 0x49, 0xA7, 0xBD, 0x80, 0x2C, 0x4, 0x49, 0x4D, 0x4D, 0x2D, 0x29, 0x83, 0x5E, 0x80, 0x5F, 0x0, 0x24, 0x80, 0x5D, 0x9, 0x52, 0x31, 0x69, 0x80, 0x80, 0x80, 0x60, 0x1, 0x1, 0x9, 0x82, 0xBC, 0x81, 0x5F, 0x82, 0xCD, 0x3, 0x2, 0x2, 0x5, 0x4, 0x81, 0x91, 0xAC, 0x5F, 0x81, 0x0, 0x2, 0x25, 0x25, 0x25, 0x80, 0x5D, 0x3, 0x1, 0x1, 0x0, 0x2D, 0x80, 0x5E, 0x2, 0x2D, 0x9, 0x44, 0x80, 0x5F, 0x3, 0x80, 0x40, 0x4, 0xC, 0x80, 0x5A, 0x5, 0x6C, 0x84, 0x68, 0x4C, 0x10, 0x8, 0x81, 0xCC, 0x81, 0x7F, 0x82, 0x5E, 0x0, 0x24, 0xA7, 0x5F, 0x81, 0x2E, 0x86, 0x0, 0xA, 0x25, 0x25, 0x1, 0x4, 0x4D, 0x2D, 0x2D, 0x29, 0x29, 0x4, 0x24, 0x81, 0x5F, 0x1, 0x80, 0x48, 0x81, 0x5E, 0x81, 0x8, 0x1, 0x68, 0x0, 0x81, 0x5F, 0x81, 0x7E, 0x82, 0x2F, 0xA8, 0x5F, 0x86, 0xC0, 0x85, 0x0, 0x2, 0x29, 0x24, 0x4, 0x80, 0x0, 0x1, 0x20, 0x60, 0x81, 0x56, 0x0, 0x64, 0x80, 0xBF, 0x82, 0x5F, 0x1, 0x80, 0x40, 0x84, 0x60, 0x83, 0x8E, 0xA8, 0x5E, 0x8E, 0x5F, 0x83, 0x62, 0xA, 0x0, 0x40, 0x60, 0x60, 0x80, 0x60, 0x60, 0xC, 0xC, 0xC, 0x68, 0x82, 0x5F, 0x1, 0x80, 0x20, 0x81, 0x60, 0x85, 0xED, 0xA9, 0x5F, 0x84, 0x32, 0x8C, 0x0, 0x2, 0x24, 0x24, 0x24, 0x80, 0x61, 0x4, 0x40, 0x8, 0xC, 0xC, 0x48, 0x83, 0x5F, 0x2, 0x64, 0x8, 0x4, 0x86, 0x2B, 0x0, 0x24, 0xA9, 0x5F, 0x91, 0xC0, 0x84, 0x0, 0x5, 0x44, 0x44, 0x2D, 0x2D, 0x2D, 0x28, 0x84, 0x5F, 0x80, 0xCA, 0x0, 0x28, 0x85, 0x7C, 0xAA, 0x5F, 0x93, 0xC0, 0x85, 0x0, 0x2, 0x29, 0x28, 0x64, 0x81, 0x5E, 0x1, 0x60, 0x44, 0x87, 0x5E, 0x0, 0x49, 0xAA, 0x5E, 0x9C, 0x5F, 0x80, 0x0, 0x7, 0x69, 0x64, 0x64, 0x60, 0x60, 0x40, 0x8, 0x8, 0x86, 0x10, 0xAB, 0x5F, 0x0, 0x0, 0x9D, 0x5F, 0x82, 0x0, 0x0, 0x44, 0x86, 0xBD, 0x1, 0x49, 0x24, 0xAC, 0x5F, 0x9E, 0xC0, 0x8C, 0x0, 0xAC, 0x5E, 0xDE, 0x5F, 0x0, 0x0, 0xAB, 0x5E, 0x0, 0x24, 0xAE, 0x5F, 0xAB, 0xC0, 0xDD, 0x5F, 0xAE, 0x5E, 0x1, 0x0, 0x0, 0xDD, 0x5F, 0xA9, 0xC0, 0x0, 0x24, 0xFF, 0x5F, 0x8F, 0x0, 0xA8, 0x5F, 0xB1, 0x5E, 0x82, 0xC0, 0xA4, 0xC4, 0xB5, 0x5F, 0x0, 0x24, 0x80, 0x0, 0xA0, 0x5E, 0x0, 0x24, 0xB2, 0x5F, 0x80, 0x61, 0x83, 0x0, 0xD5, 0x5E, 0x85, 0x60, 0x9D, 0x5F, 0xB6, 0x5E, 0xA3, 0xC0, 0xB7, 0x5E, 0x84, 0x60, 0x0, 0x0, 0x9A, 0x60, 0x0, 0x24, 0xB9, 0x5F, 0x82, 0x60, 0x82, 0x7, 0xD3, 0x5E, 0x81, 0x60, 0x86, 0x8, 0x85, 0x51, 0x8A, 0x5F, 0xBC, 0x5E, 0x8C, 0x6B, 0x80, 0x5D, 0x82, 0x0, 0xC6, 0xBE, 0x8F, 0x62, 0x8A, 0x60, 0xCD, 0x5E, 0x8D, 0x60, 0xCE, 0x5E, 0x8B, 0x5F, 0xCF, 0xBE, 0x8A, 0x60, 0xD1, 0x5E, 0x85, 0x60, 0x81, 0x7, 0xD2, 0x5E, 0x84, 0x60, 0xD4, 0x5B, 0xFF, 0x0, 0xEF, 0x0};
+static PSImage PROGMEM title = {96, 64, BitDepth8, titleData, EncodingLZ};
 
 // the ingame minecart image
 static const uint8_t PROGMEM cartData[18*11] = {0xFD, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0xFD, 0xFD, 0xFD, 0xFD, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x49, 0x49, 0x44, 0x44, 0xFD, 0xFD, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0x20, 0x49, 0x49, 0x49, 0x49, 0x20, 0x20, 0x20, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0xFD, 0x49, 0x49, 0xFD, 0xFD, 0xFD, 0xFD};
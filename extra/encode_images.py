@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+# encode_images.py
+# Last modified 17 Oct 2026
+#
+# This file is part of the PocketStar Library.
+#
+# Copyright (C) 2018  Florian Keller
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Compresses images in a header written by the PocketStar Image Converter ("convert to code, 1-dimensional").
+# The pixel arrays are replaced by their compressed form and the PSImage gets the encoding, see PS_Decoder.h.
+#
+#   python3 encode_images.py Images.h [image names] > ImagesEncoded.h
+#   python3 encode_images.py Game.psi > Compressed.psi
+#   python3 encode_images.py --sprites Images.h [image names] > Sprites.h
+#
+# Without names all images are compressed. Each image gets the smaller of the encodings, it stays raw if
+# compressing does not make it smaller. With --sprites the 8 bit images are stored as opaque spans instead
+# (see PS_Sprites.h), ALPHA pixels are left out. They can only be drawn with drawSprites() then.
+
+import re
+import sys
+
+ARRAY = re.compile(r'(static\s+)?const uint8_t PROGMEM (\w+)\[[^\]]*\]\s*=\s*\{([^}]*)\};')
+IMAGE = re.compile(r'((?:static\s+)?(?:const\s+)?PSImage PROGMEM (\w+)\s*=\s*\{\s*(\d+),\s*(\d+),\s*(BitDepth8|BitDepth16),\s*(\w+))\s*\};')
+
+
+def encode_rle(data, bytes_per_pixel):
+    pixels = [bytes(data[i:i + bytes_per_pixel]) for i in range(0, len(data), bytes_per_pixel)]
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            part = literal[:128]
+            del literal[:128]
+            out.append(len(part) - 1)
+            for p in part:
+                out.extend(p)
+
+    # a run costs one pixel and a byte, shorter runs are cheaper as part of a literal
+    shortest = 3 if bytes_per_pixel == 1 else 2
+    i = 0
+    while i < len(pixels):
+        n = 1
+        while i + n < len(pixels) and pixels[i + n] == pixels[i]:
+            n += 1
+        if n >= shortest:
+            flush_literal()
+            left = n
+            while left > 0:
+                part = min(left, 128)
+                out.append(0x80 + part - 1)
+                out.extend(pixels[i])
+                left -= part
+        else:
+            literal.extend(pixels[i:i + n])
+        i += n
+    flush_literal()
+    return bytes(out)
+
+
+def encode_lz(data, bytes_per_pixel):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush_literal():
+        while literal:
+            part = literal[:128]
+            del literal[:128]
+            out.append(len(part) - 1)
+            out.extend(part)
+
+    # greedy: the longest match within the last 256 bytes, at least 3 and at most 130 bytes long
+    i = 0
+    while i < len(data):
+        best, distance = 0, 0
+        for d in range(1, min(i, 256) + 1):
+            n = 0
+            while n < 130 and i + n < len(data) and data[i + n] == data[i + n - d]:
+                n += 1
+            if n > best:
+                best, distance = n, d
+                if n == 130:
+                    break
+        if best >= 3:
+            flush_literal()
+            out.append(0x80 + best - 3)
+            out.append(distance - 1)
+            i += best
+        else:
+            literal.append(data[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+ALPHA = 0xFD
+
+
+# row positions (2 bytes each, low byte first), then per row the number of spans and column, length, pixels of each
+def encode_spans(data, width, height):
+    rows = []
+    for y in range(height):
+        row = data[y * width:(y + 1) * width]
+        spans = bytearray()
+        count = 0
+        x = 0
+        while x < width:
+            if row[x] == ALPHA:
+                x += 1
+                continue
+            length = 1
+            while x + length < width and row[x + length] != ALPHA:
+                length += 1
+            spans += bytes([x, length]) + row[x:x + length]
+            count += 1
+            x += length
+        rows.append(bytes([count]) + spans)
+    table = bytearray()
+    position = 2 * height
+    for y in range(height):
+        table += bytes([position & 0xFF, position >> 8])
+        position += len(rows[y])
+    return bytes(table) + b''.join(rows)
+
+
+ENCODERS = {'EncodingRLE': encode_rle, 'EncodingLZ': encode_lz}
+ENCODING_VALUES = {'EncodingRLE': 1, 'EncodingLZ': 2}
+
+
+def format_array(name, data):
+    return 'static const uint8_t PROGMEM %s[%d] = {%s};' % (name, len(data), ', '.join('0x%X' % b for b in data))
+
+
+def best_encoding(data, bytes_per_pixel):
+    return min(((e, f(data, bytes_per_pixel)) for e, f in ENCODERS.items()), key=lambda r: len(r[1]))
+
+
+# thumbnails of the main menu: "PSI", version, width, height, bit depth (0: 16 bit, 1: 8 bit) and the pixels.
+# version 3 adds the encoding after the bit depth
+def encode_psi(path):
+    psi = open(path, 'rb').read()
+    if psi[:3] != b'PSI' or psi[3] != 2:
+        sys.exit('%s: not a version 2 PSI image' % path)
+    encoding, encoded = best_encoding(psi[7:], 2 if psi[6] == 0 else 1)
+    sys.stderr.write('%s: %d -> %d bytes (%s)\n' % (path, len(psi) - 7, len(encoded), encoding))
+    sys.stdout.buffer.write(b'PSI' + bytes([3, psi[4], psi[5], psi[6], ENCODING_VALUES[encoding]]) + encoded)
+
+
+def main():
+    args = sys.argv[1:]
+    sprites = '--sprites' in args
+    if sprites:
+        args.remove('--sprites')
+    if not args:
+        sys.exit('usage: encode_images.py [--sprites] Images.h [image names] | encode_images.py thumbnail.psi')
+    if args[0].lower().endswith('.psi'):
+        encode_psi(args[0])
+        return
+    source = open(args[0]).read()
+    names = set(args[1:])
+    arrays = {m.group(2): m for m in ARRAY.finditer(source)}
+
+    for image in IMAGE.finditer(source):
+        name, width, height, depth, array = image.group(2), int(image.group(3)), int(image.group(4)), image.group(5), image.group(6)
+        if names and name not in names:
+            continue
+        if array not in arrays:
+            sys.stderr.write('%s: pixel array %s not found\n' % (name, array))
+            continue
+        data = bytes(int(v, 0) for v in arrays[array].group(3).split(',') if v.strip())
+        bytes_per_pixel = 2 if depth == 'BitDepth16' else 1
+        if len(data) != width * height * bytes_per_pixel:
+            sys.stderr.write('%s: size does not match %dx%d\n' % (name, width, height))
+            continue
+
+        if sprites:
+            if bytes_per_pixel != 1:
+                sys.stderr.write('%s: spans need an 8 bit image\n' % name)
+                continue
+            encoding, encoded = 'EncodingSpans', encode_spans(data, width, height)
+            if len(encoded) > 0xFFFF:
+                sys.stderr.write('%s: spans take more than 65535 bytes\n' % name)
+                continue
+        else:
+            encoding, encoded = best_encoding(data, bytes_per_pixel)
+        if len(encoded) >= len(data) and not sprites:
+            sys.stderr.write('%s: stays raw\n' % name)
+            continue
+        sys.stderr.write('%s: %d -> %d bytes (%s)\n' % (name, len(data), len(encoded), encoding))
+        source = source.replace(arrays[array].group(0), format_array(array, encoded))
+        source = source.replace(image.group(0), '%s, %s};' % (image.group(1), encoding))
+
+    sys.stdout.write(source)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,43 @@
+/*
+Arduino.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "Arduino.h"
+#include "SPI.h"
+
+static unsigned long hostMicros = 0;
+static PSHostScb hostScb;
+PSHostScb *SCB = &hostScb;
+SPIClass SPI, SPI1;
+
+void pinMode(uint32_t, uint32_t) {}
+void digitalWrite(uint32_t, uint32_t) {}
+// buttons are pull-ups, so they are released
+int digitalRead(uint32_t) { return HIGH; }
+void analogWrite(uint32_t, uint32_t) {}
+int analogRead(uint32_t) { return 0; }
+void delay(unsigned long ms) { hostMicros += ms * 1000; }
+void delayMicroseconds(unsigned int us) { hostMicros += us; }
+unsigned long millis(void) { return hostMicros / 1000; }
+unsigned long micros(void) { return hostMicros++; }
+void attachInterrupt(uint32_t, void (*)(void), uint32_t) {}
+void detachInterrupt(uint32_t) {}
@@ -0,0 +1,50 @@
+/*
+Print.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef Print_h
+#define Print_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    size_t print(const char *text) {
+        size_t n = 0;
+        while (*text)
+            n += write(*text++);
+        return n;
+    }
+    size_t print(long value) {
+        char text[16];
+        snprintf(text, sizeof(text), "%ld", value);
+        return print(text);
+    }
+    size_t print(int value) { return print((long) value); }
+    size_t print(unsigned long value) { return print((long) value); }
+};
+
+#endif
@@ -0,0 +1,42 @@
+/*
+SPI.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef SPI_h
+#define SPI_h
+
+#include "Arduino.h"
+
+#define SPI_MODE0 0
+
+class SPIClass {
+  public:
+    void begin(void) {}
+    void end(void) {}
+    void setDataMode(uint8_t) {}
+    void setClockDivider(uint8_t) {}
+    uint8_t transfer(uint8_t) { return 0; }
+};
+
+extern SPIClass SPI, SPI1;
+
+#endif
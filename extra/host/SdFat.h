@@ -0,0 +1,53 @@
+/*
+SdFat.h
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// no SD card on the host: every file is missing
+
+#ifndef SdFat_h
+#define SdFat_h
+
+#include "Arduino.h"
+
+#define FILE_READ 0
+#define FILE_WRITE 1
+
+class File : public Stream {
+  public:
+    int available(void) { return 0; }
+    int read(void) { return -1; }
+    int read(void *, size_t) { return 0; }
+    size_t write(uint8_t) { return 0; }
+    bool seek(uint32_t) { return false; }
+    uint32_t fileSize(void) { return 0; }
+    void close(void) {}
+    operator bool() { return false; }
+};
+
+class SdFat {
+  public:
+    bool begin(uint8_t = 0) { return false; }
+    bool exists(const char *) { return false; }
+    File open(const char *, uint8_t = FILE_READ) { return File(); }
+};
+
+#endif
@@ -0,0 +1,165 @@
+/*
+test_stream.cpp
+Last modified 17 Oct 2026
+
+This file is part of the PocketStar Library.
+
+Copyright (C) 2018  Florian Keller
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+// Checks the bytes the library sends to the display, built on a PC without the board:
+//
+//   g++ -std=gnu++11 -DPS_HOST -Iextra/host -I. *.cpp extra/host/*.cpp -o test_stream && ./test_stream
+//
+// (run from the library folder). PS_HOST routes every command and data byte into the sink below.
+
+#include <PocketStar.h>
+#include "PS_Internal.h"
+
+struct Byte {
+    uint8_t value;
+    bool command;
+};
+
+static Byte stream[256];
+static uint16_t streamLength = 0;
+static uint8_t failures = 0;
+
+static void record(const uint8_t *data, uint16_t count, bool command) {
+    for (uint16_t i = 0; i < count && streamLength < 256; i++) {
+        stream[streamLength].value = data[i];
+        stream[streamLength].command = command;
+        streamLength++;
+    }
+}
+
+// compares the recorded stream with the expected bytes, 'c' marks command bytes and 'd' data bytes
+static void expect(const char *name, const char *kinds, const uint8_t *bytes, uint16_t count) {
+    boolean ok = streamLength == count;
+    for (uint16_t i = 0; ok && i < count; i++)
+        ok = stream[i].value == bytes[i] && stream[i].command == (kinds[i] == 'c');
+    printf("%s: %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok) {
+        for (uint16_t i = 0; i < streamLength; i++)
+            printf("%c%02X ", stream[i].command ? 'c' : 'd', stream[i].value);
+        printf("\n");
+        failures++;
+    }
+    streamLength = 0;
+}
+
+static void check(const char *name, boolean ok) {
+    printf("%s: %s\n", name, ok ? "ok" : "FAIL");
+    if (!ok)
+        failures++;
+}
+
+// the sketch functions the library calls
+void initialize() {}
+void update(float) {}
+boolean pause() { return true; }
+void resume() {}
+
+int main() {
+    PSTransfer::setSink(record);
+    pocketstar.begin();
+    // the init sequence ends with the remap, the brightness, clearing the screen and switching the display on
+    const uint8_t init[] = {0xAE, 0xAE, 0xA1, 0x00, 0xA2, 0x00, 0xA4, 0xA8, 0x3F, 0xAD, 0x8E, 0xB0, 0x0B, 0xB1, 0x31, 0xB3,
+                            0xF0, 0x8A, 0x64, 0x8B, 0x78, 0x8C, 0x64, 0xBB, 0x3A, 0xBE, 0x3E, 0x81, 0x91, 0x82, 0x50, 0x83,
+                            0x7D, 0xA0, 0x32, 0x87, 0x05, 0x25, 0x00, 0x00, 0x5F, 0x3F, 0xAF};
+    expect("begin", "ccccccccccccccccccccccccccccccccccccccccccc", init, sizeof(init));
+
+    // the contrast of the init sequence and the remap written by begin() are known, nothing is sent again
+    pocketstar.setContrast(0x91, 0x50, 0x7D);
+    pocketstar.setBitDepth(BitDepth8);
+    expect("cache after begin", "", NULL, 0);
+    pocketstar.setContrast(0x91, 0x50, 0x7E);
+    const uint8_t contrast[] = {0x83, 0x7E};
+    expect("setContrast", "cc", contrast, sizeof(contrast));
+
+    // fill on, then the rectangle command with the outline and fill color (6 bit per channel)
+    pocketstar.drawRect(2, 3, 10, 5, true, RED_16b);
+    const uint8_t rect[] = {0x26, 0x01, 0x22, 0x02, 0x03, 0x0B, 0x07, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00};
+    expect("drawRect", "ccccccccccccc", rect, sizeof(rect));
+
+    // the fill mode is cached, a second rectangle only sends the rectangle command
+    pocketstar.drawRect(0, 0, 1, 1, true, RED_16b);
+    const uint8_t cached[] = {0x22, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00};
+    expect("drawRect cached", "ccccccccccc", cached, sizeof(cached));
+
+    // an image: column and row window as commands, then the pixels as data
+    static const uint8_t pixels[6] = {1, 2, 3, 4, 5, 6};
+    static const PSImage image = {3, 2, BitDepth8, pixels, EncodingRaw, NULL};
+    pocketstar.drawImage(10, 20, &image);
+    pocketstar.waitForTransfer();
+    const uint8_t window[] = {0x15, 0x0A, 0x0C, 0x75, 0x14, 0x15, 1, 2, 3, 4, 5, 6};
+    expect("drawImage", "ccccccdddddd", window, sizeof(window));
+
+    // an image made of spans: a window for each span, the transparent pixel between them is not sent
+    static const uint8_t opaque[4] = {1, ALPHA, 2, 3};
+    static const PSImage sparse = {4, 1, BitDepth8, opaque, EncodingRaw, NULL};
+    static uint8_t spanData[16];
+    const PSImage spans = PS_encodeSpans(&sparse, spanData);
+    pocketstar.drawImage(10, 20, &spans);
+    pocketstar.waitForTransfer();
+    const uint8_t spanWindows[] = {0x15, 0x0A, 0x0A, 0x75, 0x14, 0x14, 1, 0x15, 0x0C, 0x0D, 2, 3};
+    expect("drawImage spans", "ccccccdcccdd", spanWindows, sizeof(spanWindows));
+
+    // rows of a shape switch from pixels to rectangles where the rectangle gets cheaper, one pixel on each side
+    check("rectFaster 16 bit", !PS_rectFaster(77, 2) && PS_rectFaster(78, 2));
+    check("rectFaster 8 bit", !PS_rectFaster(155, 1) && PS_rectFaster(156, 1));
+    check("rectFaster full screen", PS_rectFaster(96 * 64, 1) && PS_rectFaster(96 * 64, 2));
+    check("commandTime floor", PS_commandTime(1) == PS_COMMAND_MIN_TIME && PS_commandTime(96 * 64) >= 400);
+
+    // a flat ellipse is a single span: 77 pixels are sent as data, 79 pixels as one rectangle command
+    pocketstar.setBitDepth(BitDepth16);
+    streamLength = 0;
+    pocketstar.drawEllipse(47, 30, 38, 0, true, RED_16b);
+    pocketstar.waitForTransfer();
+    check("span of 77 pixels", streamLength == 6 + 77 * 2 && stream[0].value == 0x15 && !stream[6].command);
+    streamLength = 0;
+    pocketstar.drawEllipse(47, 30, 39, 0, true, RED_16b);
+    check("span of 79 pixels", streamLength == 11 && stream[0].value == 0x22);
+    streamLength = 0;
+
+    // with a gamma table the fills get exactly the table entry of the 8 bit color, as pixels, as a rectangle and from a shadow
+    static uint16_t gamma[256];
+    PocketStar::makeExpansionTable(gamma, 2.2);
+    const uint16_t entry = gamma[0x49];
+    pocketstar.setBitDepth(BitDepth8);
+    pocketstar.setColorExpansion(true, gamma);
+    streamLength = 0;
+    pocketstar.drawEllipse(47, 30, 38, 0, true, (uint8_t) 0x49);
+    pocketstar.waitForTransfer();
+    check("gamma pixels", stream[6].value == (entry >> 8) && stream[7].value == (entry & 0xFF));
+    streamLength = 0;
+    pocketstar.drawEllipse(47, 30, 39, 0, true, (uint8_t) 0x49);
+    check("gamma rectangle", stream[5].value == PS_red6(entry) && stream[6].value == PS_green6(entry) && stream[7].value == PS_blue6(entry));
+    static uint8_t buffer[96 * 64];
+    PSCanvas canvas(buffer, BitDepth8);
+    pocketstar.setShadow(&canvas);
+    pocketstar.drawRect(4, 4, 1, 1, true, (uint8_t) 0x49);
+    streamLength = 0;
+    pocketstar.flush();
+    pocketstar.waitForTransfer();
+    check("gamma shadow", streamLength >= 2 && stream[streamLength - 2].value == (entry >> 8) && stream[streamLength - 1].value == (entry & 0xFF));
+    pocketstar.setShadow(NULL);
+    pocketstar.setColorExpansion(false);
+    streamLength = 0;
+
+    return failures ? 1 : 0;
+}